@@ -87,6 +87,12 @@ cwarnings += -Wno-array-bounds
 cwarnings += -Wno-stringop-overflow
 endif
 
+ifdef W_NO_MAYBE_UNINITIALIZED
+# gcc-12 reports false positives on struct copies that are subsequently
+# read through byte offsets.  Disabled in the linux kernel as well.
+cwarnings += -Wno-maybe-uninitialized
+endif
+
 ifdef W_NO_DEPRECATED_DECLARATIONS
 # signal() and sigaction() are deprecated in libc-2.32,
 # but we have to intercept them, because applications use them.
@@ -146,6 +152,26 @@ ifdef GCOV
   MMAKE_DIR_LINKFLAGS += -fprofile-arcs
 endif
 
+# Link-time optimisation and profile-guided optimisation for the
+# user-level components (the kernel modules are built by kbuild and are
+# not affected).  Typical PGO cycle:
+#   make ... PGO_GENERATE=/tmp/oo-pgo     # instrumented build
+#   <run a representative workload, eg. tests/bench/oo_bench>
+#   make ... PGO_USE=/tmp/oo-pgo          # optimised build
+ifdef LTO
+  MMAKE_CFLAGS        += -flto
+  MMAKE_DIR_LINKFLAGS += -flto
+endif
+
+ifdef PGO_GENERATE
+  MMAKE_CFLAGS        += -fprofile-generate=$(PGO_GENERATE)
+  MMAKE_DIR_LINKFLAGS += -fprofile-generate=$(PGO_GENERATE)
+endif
+
+ifdef PGO_USE
+  MMAKE_CFLAGS        += -fprofile-use=$(PGO_USE) -fprofile-correction
+endif
+
 MMAKE_CFLAGS += -DTRANSPORT_CONFIG_OPT_HDR='<$(TRANSPORT_CONFIG_OPT_HDR)>'
 
 ######################################################################
@@ -144,6 +144,39 @@ vi_set_rm_rsops(efch_resource_t* rs, ci_resource_table_t* priv_opt,
       rc = efch_filter_list_op_block(rs->rs_base, efrm_vi_set_get_pd(vi_set),
                                      &rs->vi_set.fl, op);
       break;
+    case CI_RSOP_VI_SET_GET_RSS:
+    case CI_RSOP_VI_SET_UPDATE_RSS:
+      {
+        uint32_t indir[EFRM_RSS_INDIRECTION_TABLE_LEN];
+        uint8_t key[EFRM_RSS_KEY_LEN];
+        void *user_indir = (void *)(unsigned long)op->u.vi_set_rss.indir_ptr;
+        void *user_key = (void *)(unsigned long)op->u.vi_set_rss.key_ptr;
+
+        if( op->u.vi_set_rss.indir_len != EFRM_RSS_INDIRECTION_TABLE_LEN ||
+            op->u.vi_set_rss.key_len != EFRM_RSS_KEY_LEN ) {
+          rc = -EINVAL;
+          break;
+        }
+        if( op->op == CI_RSOP_VI_SET_GET_RSS ) {
+          rc = efrm_vi_set_get_rss(vi_set, EFRM_RSS_MODE_ID_DEFAULT,
+                                   indir, key);
+          if( rc < 0 )
+            break;
+          if( copy_to_user(user_indir, indir, sizeof(indir)) ||
+              copy_to_user(user_key, key, sizeof(key)) )
+            rc = -EFAULT;
+        }
+        else {
+          if( copy_from_user(indir, user_indir, sizeof(indir)) ||
+              copy_from_user(key, user_key, sizeof(key)) ) {
+            rc = -EFAULT;
+            break;
+          }
+          rc = efrm_vi_set_update_rss(vi_set, EFRM_RSS_MODE_ID_DEFAULT,
+                                      indir, key);
+        }
+        break;
+      }
     default:
       flags = 0;
       if( efrm_vi_set_num_vis(vi_set) > 1 )
@@ -214,6 +214,8 @@ typedef struct ci_resource_op_s {
 # define                CI_RSOP_EXT_FREE                0x89
 # define                CI_RSOP_EXT_MSG                 0x8A
 # define                CI_RSOP_RXQ_REFRESH             0x8B
+# define                CI_RSOP_VI_SET_GET_RSS          0x8C
+# define                CI_RSOP_VI_SET_UPDATE_RSS       0x8D
 
   union {
     struct {
@@ -319,6 +321,12 @@ typedef struct ci_resource_op_s {
       uint64_t          current_mappings;
       uint32_t          max_superbufs;
     } rxq_refresh;
+    struct {
+      uint64_t          indir_ptr;  /* uint32_t[indir_len] */
+      uint64_t          key_ptr;    /* uint8_t[key_len] */
+      uint32_t          indir_len;
+      uint32_t          key_len;
+    } vi_set_rss;
   } u CI_ALIGN(8);
 } ci_resource_op_t;
 
@@ -67,6 +67,19 @@ efrm_vi_set_get_base(struct efrm_vi_set *);
 extern int
 efrm_vi_set_get_rss_context(struct efrm_vi_set *, unsigned rss_id);
 
+/* Copy out the indirection table (EFRM_RSS_INDIRECTION_TABLE_LEN entries)
+ * and hash key (EFRM_RSS_KEY_LEN bytes) of a live RSS context.  Either
+ * output pointer may be NULL. */
+extern int
+efrm_vi_set_get_rss(struct efrm_vi_set *, unsigned rss_id,
+		    uint32_t *indir_out, uint8_t *key_out);
+
+/* Reprogram the indirection table and hash key of a live RSS context.
+ * Table entries must be less than the number of VIs in the set. */
+extern int
+efrm_vi_set_update_rss(struct efrm_vi_set *, unsigned rss_id,
+		       const uint32_t *indir, const uint8_t *key);
+
 extern struct efrm_resource *
 efrm_vi_set_to_resource(struct efrm_vi_set *);
 
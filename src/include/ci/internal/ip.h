@@ -510,6 +510,19 @@ ci_inline void ci_netif_send(ci_netif* ni, ci_ip_pkt_fmt* pkt)
   pkt->flags |= CI_PKT_FLAG_TX_PENDING;
   __ci_netif_send(ni, pkt);
 }
+
+/* Defer TX doorbells for a batch of ci_netif_send() calls.  Between
+ * _start() and _flush() direct sends initialise descriptors only, and
+ * _flush() rings one doorbell per interface touched.  The stack lock
+ * must be held throughout. */
+ci_inline void ci_netif_tx_push_defer_start(ci_netif* ni)
+{
+  ci_assert(ci_netif_is_locked(ni));
+  ci_assert_equal(ni->state->tx_push_deferred_intfs, 0);
+  ni->state->tx_push_defer_on = 1;
+}
+
+extern void ci_netif_tx_push_defer_flush(ci_netif* ni) CI_HF;
 extern bool ci_netif_send_immediate(ci_netif* netif, ci_ip_pkt_fmt* pkt,
                                     const struct ef_vi_tx_extra* extra) CI_HF;
 extern int ci_netif_rx_post(ci_netif* netif, int nic_index, ef_vi* vi) CI_HF;
@@ -3096,6 +3109,14 @@ ci_inline ci_ip_pkt_fmt* ci_netif_pkt_alloc_nonb(ci_netif* ni)
 }
 
 
+/* Return a linked list of free packets to the stack's non-blocking pool
+ * with a single compare-and-swap, regardless of list length.  This is
+ * the batching primitive for threads freeing packets without the stack
+ * lock: accumulate buffers locally (as the poll state's
+ * tx_pkt_free_list and the zero-copy bulk-release paths do), link them
+ * through pkt->next, and splice the whole chain here.  The pool is
+ * harvested back into the ordinary free pool by the next lock holder.
+ */
 ci_inline void ci_netif_pkt_free_nonb_list(ci_netif *ni, oo_pkt_p pkt_list,
                                              ci_ip_pkt_fmt *pkt_list_tail) 
 {
@@ -3988,7 +4009,10 @@ ci_inline void ci_tcp_sendq_drop(ci_netif* ni, ci_tcp_state* ts)
 }
 
 ci_inline void ci_tcp_retrans_drop(ci_netif* ni, ci_tcp_state* ts)
-{ ci_ip_queue_drop(ni, &ts->retrans); }
+{
+  ci_ip_queue_drop(ni, &ts->retrans);
+  ts->rtq_sack_hint = OO_PP_NULL;
+}
 
 extern int ci_tcp_add_fin(ci_tcp_state* ts, ci_netif* netif) CI_HF;
 /* Try to re-send pending FIN, return true in success. */
@@ -827,11 +827,22 @@ typedef struct {
 #define CI_PIO_BUDDY_MAX_ORDER (CI_PIO_BUF_ORDER - CI_CFG_MIN_PIO_BLOCK_ORDER)
 
 
+/* Number of recently-freed blocks cached per order, bypassing the buddy
+ * lists.  See ci_pio_buddy_alloc(). */
+#define CI_PIO_BUDDY_CACHE_SIZE 4
+
 typedef struct {
   struct oo_p_dllink    free_lists[CI_PIO_BUDDY_MAX_ORDER+1];
   struct oo_p_dllink    links[1ul<<CI_PIO_BUDDY_MAX_ORDER];
   ci_uint8              orders[1ul<<CI_PIO_BUDDY_MAX_ORDER];
   ci_int32              initialised;
+  /* LIFO cache of free block addresses, per order.  Blocks here are not
+   * on the free lists and are not merged with their buddies, which makes
+   * the common alloc/free cycle during connection churn O(1) instead of
+   * a merge on free followed by a split on alloc. */
+  ci_int32              free_cache[CI_PIO_BUDDY_MAX_ORDER+1]
+                                  [CI_PIO_BUDDY_CACHE_SIZE];
+  ci_uint8              free_cache_n[CI_PIO_BUDDY_MAX_ORDER+1];
 } ci_pio_buddy_allocator;
 
 
@@ -847,6 +858,8 @@ typedef struct {
                                          containing page allocation, e.g. if
                                          packet buffers are 2K and pages are
                                          2MB then 10. */
+  CI_ULCONST ci_int8    numa_node;  /**< NUMA node the set's pages were
+                                         allocated on, or -1 if unknown. */
 } oo_pktbuf_set;
 
 typedef struct {
@@ -1082,6 +1095,16 @@ struct ci_netif_state_s {
 
   ci_uint64             evq_last_prime CI_ALIGN(8);
 
+  /* Current adaptive per-poll event budget; see EF_ADAPTIVE_POLL. */
+  ci_uint32             poll_budget;
+
+  /* When non-zero, __ci_netif_send() initialises TX descriptors without
+   * ringing the doorbell and records the interfaces needing a push here,
+   * so a batch of sends can share one doorbell.  Only valid while the
+   * stack lock is held; see ci_netif_tx_push_defer_start()/_flush(). */
+  ci_uint8              tx_push_defer_on;
+  ci_uint32             tx_push_deferred_intfs;
+
   CI_ULCONST ci_uint32  stack_id; /* FIXME equal to thr->id */
 #define ONLOAD_PRETTY_NAME_MAXLEN (CI_CFG_STACK_NAME_LEN + 8)
   CI_ULCONST char       pretty_name[ONLOAD_PRETTY_NAME_MAXLEN];
@@ -1386,7 +1409,12 @@ struct ci_netif_state_s {
   CI_ULCONST ci_uint8   hash_salt[16];
 
 #if CI_CFG_STATS_NETIF
-  ci_netif_stats        stats;
+  /* Cacheline-align the statistics block so counter increments do not
+   * contend with the read-mostly fields either side of it.  Counters are
+   * only written under the stack lock (or from the lock holder's poll),
+   * so sharding them per thread would buy nothing further: the writes
+   * already serialise on the lock, and the cachelines travel with it. */
+  ci_netif_stats        stats CI_ALIGN(CI_CACHE_LINE_SIZE);
 #endif
 
 #define OO_INTF_I_SEND_VIA_OS   CI_CFG_MAX_INTERFACES
@@ -2262,6 +2290,12 @@ struct  ci_udp_state_s {
    */
   ci_uint32 tx_count;
 
+  /* Software token-bucket pacing, set via SO_MAX_PACING_RATE.
+   * pace_rate is in bytes per second; 0 means pacing is disabled. */
+  ci_uint64 pace_rate CI_ALIGN(8);
+  ci_int64  pace_tokens;    /* bytes currently available to send */
+  ci_uint64 pace_last_frc;  /* frc of the last token refill */
+
   /* Cache for IP_PKTINFO and IPV6_PKTINFO */
   struct {
     /* PKT info: */
@@ -2349,11 +2383,17 @@ struct oo_pipe {
 #define OO_PIPE_DEFAULT_SIZE  (128 * OO_PIPE_BUF_MAX_SIZE)
 #define OO_PIPE_INITIAL_BUFS  OO_PIPE_MIN_BUFS
 
-  /* in future pipe capacity may be up to 1048576 - define from linux kernel,
-   * so 32-bits are enough, rolling over 0 is not a problem. */
-  volatile ci_uint32 bytes_added;           /*!< Total number of bytes written to the pipe */
-  volatile ci_uint32 bytes_removed;         /*!< Total number of bytes removed
-                                             * from the pipe */
+  /* Pipe capacity may be up to CI_CFG_MAX_PIPE_SIZE, so 32-bits are
+   * enough, and rolling over 0 is not a problem.
+   *
+   * The writer updates bytes_added and the reader updates bytes_removed,
+   * each polling the other's counter, so they are kept on separate
+   * cachelines to stop the two ends' stores from fighting over one
+   * line. */
+  volatile ci_uint32 bytes_added CI_ALIGN(64);  /*!< Total number of bytes
+                                                 * written to the pipe */
+  volatile ci_uint32 bytes_removed CI_ALIGN(64);/*!< Total number of bytes
+                                                 * removed from the pipe */
 };
 
 
@@ -2598,6 +2638,15 @@ struct ci_tcp_state_s {
 
   ci_ip_pkt_queue     retrans;    /**< Retransmit queue. */
 
+  oo_pkt_p            rtq_sack_hint; /**< Start of the most recently SACKed
+                                      * block in the retransmit queue; SACK
+                                      * processing resumes its walk here
+                                      * rather than at the queue head.
+                                      * OO_PP_NULL when not valid. */
+  ci_uint32           rtq_sack_hint_seq; /**< start_seq of rtq_sack_hint at
+                                          * the time it was recorded, for
+                                          * validation. */
+
   ci_ip_pkt_queue     recv1;      /**< Receive queue. */
   ci_ip_pkt_queue     recv2;      /**< Aux receive queue for urgent data */
   oo_pkt_p            recv1_extract; 
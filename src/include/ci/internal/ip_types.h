@@ -372,6 +372,10 @@ struct ci_netif_poll_state {
   oo_pkt_p  tx_pkt_free_list;
   oo_pkt_p* tx_pkt_free_list_insert;
   int       tx_pkt_free_list_n;
+  /* The TCP socket that took the previous received segment in this poll.
+   * Bursts commonly contain runs of segments for the same flow, so the
+   * RX demux tries this socket before the full filter-table lookup. */
+  ci_sock_cmn* rx_last_sock;
 };
 
 
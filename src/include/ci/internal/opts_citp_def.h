@@ -152,7 +152,14 @@ CI_CFG_OPT("EF_EPOLL_MT_SAFE", ul_epoll_mt_safe, ci_uint32,
 "member are bind(), connect(), listen() and close()."
 "\n"
 "This option improves performance with EF_UL_EPOLL=1 or 3 and also with "
-"EF_UL_EPOLL=2 and EF_EPOLL_CTL_FAST=1.",
+"EF_UL_EPOLL=2 and EF_EPOLL_CTL_FAST=1."
+"\n"
+"When many threads block on one epoll set (eg. the shared-epfd accept "
+"pattern), the per-set lock that this option removes is the main point of "
+"serialisation; the lock already absorbs concurrent epoll_ctl() calls by "
+"queueing them onto the current holder, so enabling this option (or giving "
+"each thread its own epoll set over SO_REUSEPORT listeners) is the "
+"supported way to eliminate the remaining contention.",
            1, , 0, 0, 1, yesno)
 
 CI_CFG_OPT("EF_WODA_SINGLE_INTERFACE", woda_single_if, ci_uint32,
@@ -473,6 +480,16 @@ CI_CFG_OPT("EF_POLL_USEC", ef_poll_usec_meta_option, ci_uint32,
 "enabling spinning for UDP sends and receives, TCP sends and receives, "
 "select, poll and epoll_wait(), and enabling lock buzzing."
 "\n"
+"A finite spin timeout is itself an adaptive spin/interrupt mode with "
+"hysteresis: while event inter-arrival stays under the timeout the thread "
+"never stops spinning, and once the stack has been quiet for the full "
+"timeout the thread arms interrupts and parks in the kernel, to be woken "
+"by the next event.  Workloads that must spin through the trading day but "
+"should not burn cores overnight can therefore set a generous finite "
+"timeout (eg. hundreds of milliseconds) instead of spinning forever; "
+"there is no cliff at the transition, since the first event after parking "
+"is delivered via interrupt and spinning resumes immediately."
+"\n"
 OO_SPIN_BLURB,
            , , 0, MIN, MAX, time:usec)
 
@@ -930,6 +930,17 @@ CI_CFG_OPT("EF_RXQ_LIMIT", rxq_limit, ci_int32,
 "when it has a value larger than the ring size (EF_RXQ_SIZE).",
            , , 65535, CI_CFG_RX_DESC_BATCH, 65535, level)
 
+CI_CFG_OPT("EF_ADAPTIVE_POLL", adaptive_poll, ci_uint32,
+"Adapt the per-poll event budget at runtime.  The budget grows (up to 4x "
+"EF_EVS_PER_POLL) while the event queue remains deep after a full batch, "
+"and shrinks (down to a quarter of EF_EVS_PER_POLL) while threads are "
+"spinning on latency-sensitive sockets.  This lets one stack serve both "
+"throughput and latency workloads without separate static tunings.  The "
+"controller's decisions are counted in the stack statistics "
+"(adaptive_poll_grow/shrink) and the current budget is shown by "
+"onload_stackdump netif_extra (poll_budget).",
+           , , 0, 0, 1, yesno)
+
 CI_CFG_OPT("EF_EVS_PER_POLL", evs_per_poll, ci_uint32,
 "Sets the number of hardware network events to handle before performing other "
 "work.  This is a hint for internal tuning, and the actual number handled "
@@ -1367,6 +1378,24 @@ CI_CFG_OPT("EF_CTPIO_SWITCH_BYPASS", ctpio_switch_bypass, ci_uint32,
            1, , 0, 0, 1, yesno)
 #endif
 
+CI_CFG_OPT("EF_TCP_RECV_NT_THRESHOLD", tcp_recv_nt_thresh, ci_uint32,
+"Receive-path copies of at least this many bytes use non-temporal stores "
+"into the application buffer.  For bulk transfers (eg. multi-megabyte "
+"objects) this avoids flushing the CPU caches with payload bytes that the "
+"application will not touch until much later, substantially reducing the "
+"per-byte receive cost.  Latency-sensitive applications that read the "
+"payload immediately should leave this disabled.  0 means disabled.",
+           , , 0, 0, MAX, count)
+
+CI_CFG_OPT("EF_TCP_TX_FILL_BATCH", tcp_tx_fill_batch, ci_uint16,
+"Number of TCP segments to build per pass when filling the send queue.  "
+"Headers are templated and the whole batch is pushed to the adapter with a "
+"single doorbell, so larger values reduce CPU cost per byte for large "
+"sends (at a small cost in packet-buffer burstiness).  The default "
+"preserves the traditional batch of 8; bulk streaming workloads making "
+"64KB writes benefit from 32 or more.",
+           , , CI_CFG_TCP_TX_BATCH, 1, 64, count)
+
 CI_CFG_OPT("EF_TX_PUSH_THRESHOLD", tx_push_thresh, ci_uint16,
 "Sets a threshold for the number of outstanding sends before we stop using "
 "TX descriptor push.  This has no effect if EF_TX_PUSH=0.  This "
@@ -1418,6 +1447,16 @@ CI_CFG_OPT("EF_TCP_SHARED_LOCAL_PORTS_REUSE_FAST",
 "LAST-ACK.",
            1, , 0, 0, 1, yesno)
 
+CI_CFG_OPT("EF_TCP_SHARED_LOCAL_PORTS_POOLS", tcp_shared_local_ports_pools,
+           ci_uint32,
+"Number of pools to shard the shared local ports across on stacks that are "
+"not part of a cluster (rounded up to a power of two, maximum 64).  "
+"Clustered stacks ignore this: their pool count is dictated by RSS.  With "
+"many threads opening outgoing connections concurrently, sharding keeps "
+"connections to different destinations off each other's pool lists, which "
+"shortens the search for a usable port.",
+           , , 1, 1, 64, count)
+
 CI_CFG_OPT("EF_TCP_SHARED_LOCAL_PORTS_MAX", tcp_shared_local_ports_max,
            ci_uint32,
 "This setting sets the maximum size of the pool of local shared ports "
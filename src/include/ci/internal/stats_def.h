@@ -889,3 +889,42 @@ OO_STAT("Number of ICMP messages handled from lock hook",
         ci_uint32, rx_icmp_hooked, count)
 
 #endif
+
+OO_STAT("Number of TCP RTO timers fired.",
+        ci_uint32, timer_rto, count)
+OO_STAT("Number of TCP delayed-ACK timers fired.",
+        ci_uint32, timer_delack, count)
+OO_STAT("Number of TCP zero-window probe timers fired.",
+        ci_uint32, timer_zwin, count)
+OO_STAT("Number of TCP keepalive timers fired.",
+        ci_uint32, timer_kalive, count)
+OO_STAT("Number of TCP listen (SYNACK retransmit) timers fired.",
+        ci_uint32, timer_listen, count)
+OO_STAT("Number of TCP cork timers fired.",
+        ci_uint32, timer_cork, count)
+OO_STAT("Number of other stack timers fired (timeout-state, PMTU, stats "
+        "and recycle timers).",
+        ci_uint32, timer_other, count)
+OO_STAT("Number of timer-wheel cascade operations performed.",
+        ci_uint32, timer_cascades, count)
+OO_STAT("Number of timers moved between wheels by cascading.  Large "
+        "values per cascade show up as poll-time outliers.",
+        ci_uint32, timer_cascade_moves, count)
+
+OO_STAT("Number of times the adaptive poll controller grew the per-poll "
+        "event budget.",
+        ci_uint32, adaptive_poll_grow, count)
+OO_STAT("Number of times the adaptive poll controller shrank the per-poll "
+        "event budget.",
+        ci_uint32, adaptive_poll_shrink, count)
+
+OO_STAT("Number of ACKs emitted by the coalescing point at the end of a "
+        "poll batch (at most one per flow per batch).",
+        ci_uint32, acks_sent_post_poll, count)
+OO_STAT("Number of ACKs forced out immediately by protocol rules "
+        "(out-of-order data, FIN and similar), bypassing coalescing.",
+        ci_uint32, acks_forced, count)
+
+OO_STAT("Number of UDP datagrams delivered to additional sockets by "
+        "reference (multicast/broadcast fan-out within the stack).",
+        ci_uint32, udp_rx_fanout_indirect, count)
@@ -96,9 +96,12 @@
  * EF_UL_EPOLL=2 and EF_EPOLL_CTL_FAST=1 */
 #define CI_CFG_EPOLL_MAX_POSTPONED      10
 
-/* Arbitrary limit of 1MB following linux kernel in Onload pipe
- * implementation */
-#define CI_CFG_MAX_PIPE_SIZE            (1<<20)
+/* Upper bound on F_SETPIPE_SZ for Onload pipes: 32MB, above the linux
+ * kernel's 1MB default limit, to let bursty producer/consumer pairs
+ * absorb larger scheduling gaps without falling back to blocking.
+ * Note a pipe resized to the maximum pins a correspondingly large
+ * slice of the stack's packet-buffer pool for its lifetime. */
+#define CI_CFG_MAX_PIPE_SIZE            (1<<25)
 
 /* Enable this to support port striping. */
 #define CI_CFG_PORT_STRIPING            0
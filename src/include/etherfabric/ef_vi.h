@@ -790,6 +790,14 @@ typedef struct {
   uint32_t rx_ev_bad_q_label;
   /** Gaps in the event queue (empty slot followed by event) */
   uint32_t evq_gap;
+  /** TX completions where CTPIO cut-through succeeded.  Only maintained
+   ** when the adaptive CTPIO controller is enabled. */
+  uint32_t ctpio_success;
+  /** CTPIO attempts not observed to succeed, accumulated per adaptation
+   ** window.  Only maintained when the adaptive controller is enabled. */
+  uint32_t ctpio_fallback;
+  /** CTPIO attempts suppressed by the adaptive controller */
+  uint32_t ctpio_suppressed;
 } ef_vi_stats;
 
 /*! \brief The type of NIC in use
@@ -903,6 +911,15 @@ typedef struct ef_vi {
   char*                         vi_ctpio_mmap_ptr;
   /** Controls rate of writes into CTPIO aperture */
   uint32_t                      vi_ctpio_wb_ticks;
+  /** CTPIO successes observed in the current adaptation window */
+  uint16_t                      vi_ctpio_ok_in_win;
+  /** CTPIO attempts made in the current adaptation window */
+  uint16_t                      vi_ctpio_attempts_in_win;
+  /** Number of further CTPIO attempts to suppress (0 = attempt CTPIO) */
+  uint32_t                      vi_ctpio_suppress_n;
+  /** Non-zero when the adaptive CTPIO controller is enabled for this VI
+   ** (opt-in via EF_VI_CTPIO_ADAPTIVE) */
+  uint8_t                       vi_ctpio_adaptive;
   /** Length of region allocated at ep_state */
   int                           ep_state_bytes;
   /** True if the virtual interface is in a cluster */
@@ -957,6 +974,8 @@ typedef struct ef_vi {
   struct efab_efct_rxq_uk_shm*  efct_shm;
   /** 1 + highest allowed index of a used element in efct_rxq */
   int                           max_efct_rxq;
+  /** Next efct RX queue to poll first; rotated per poll for fairness */
+  unsigned                      efct_poll_rr;
 
   /** Number of TX alternatives for the virtual interface */
   unsigned                      tx_alt_num;
@@ -972,6 +991,16 @@ typedef struct ef_vi {
   int                         (*xdp_kick)(struct ef_vi*);
   void*                         xdp_kick_context;
 
+  /** Callback to refill the RX ring, invoked from the event poll when
+   * the fill level drops below rx_refill_threshold */
+  void                        (*rx_refill_fn)(struct ef_vi*, void*);
+  void*                         rx_refill_context;
+  /** RX fill level below which rx_refill_fn is invoked (0 = disabled) */
+  unsigned                      rx_refill_threshold;
+  /** Driver eventq_poll op, saved when auto-refill wraps it */
+  int                         (*rx_refill_orig_poll)(struct ef_vi*,
+                                                     ef_event*, int evs_len);
+
   /*! \brief Driver-dependent operations. */
   /* Doxygen comment above is the detailed description of ef_vi::ops */
   struct ops {
@@ -1047,6 +1076,11 @@ typedef struct ef_vi {
                                    size_t len, ef_request_id dma_id);
     int (*transmitv_ctpio_fallback)(struct ef_vi* vi, const ef_iovec* dma_iov,
                                     int dma_iov_len, ef_request_id dma_id);
+    /** Transmit a batch of packets, pushing all descriptors with a single
+     ** doorbell */
+    int (*transmitv_batch)(struct ef_vi*, const ef_iovec* iov,
+                           const int* iov_lens, const ef_request_id* dma_ids,
+                           int n_pkts);
   } ops;  /**< Driver-dependent operations. */
   /* Doxygen comment above is documentation for the ops member of ef_vi */
 
@@ -1331,6 +1365,64 @@ ef_vi_inline int ef_vi_receive_capacity(const ef_vi* vi)
 extern int ef_vi_receive_post(ef_vi* vi, ef_addr addr, ef_request_id dma_id);
 
 
+/*! \brief Initialize a batch of RX descriptors and submit them with a
+**         single push
+**
+** \param vi      The virtual interface for which to post descriptors.
+** \param addrs   Array of DMA addresses of the packet buffers, as
+**                obtained from ef_memreg_dma_addr().
+** \param dma_ids Array of DMA ids to associate with the descriptors.
+**                These are completely arbitrary, and can be used for
+**                subsequent tracking of buffers.
+** \param n       Number of descriptors to post.
+**
+** \return The number of descriptors posted (which may be fewer than n if
+**         the descriptor ring fills), or a negative error code.
+**
+** Initialize RX descriptors for a whole batch of buffers and then submit
+** them to the NIC with a single push.  When refilling the ring at high
+** packet rates this amortizes the push cost over the batch and is
+** substantially cheaper than calling ef_vi_receive_post() per buffer.
+**
+** Note that for Solarflare 7000-series NICs, descriptors are submitted
+** only in multiples of 8. This is to conform with hardware requirements.
+*/
+extern int ef_vi_receive_post_batch(ef_vi* vi, const ef_addr* addrs,
+                                    const ef_request_id* dma_ids, int n);
+
+
+/*! \brief The type of an RX ring refill callback
+**
+** \param vi      The virtual interface needing a refill.
+** \param context The context pointer registered along with the callback.
+**
+** The callback should post buffers from the application's free ring,
+** normally with ef_vi_receive_post_batch().
+*/
+typedef void (*ef_vi_rx_refill_fn)(ef_vi* vi, void* context);
+
+
+/*! \brief Arrange automatic RX ring refill from within the event poll
+**
+** \param vi        The virtual interface to auto-refill.
+** \param threshold Fill level below which the refill callback is invoked,
+**                  or 0 to disable auto-refill.
+** \param refill_fn Callback invoked to post more buffers.
+** \param context   Opaque pointer passed to the callback.
+**
+** \return 0 on success, or a negative error code.
+**
+** After this call, ef_eventq_poll() checks the RX ring fill level after
+** each poll and invokes \p refill_fn whenever it is below \p threshold.
+** This moves refill out of the application's per-packet path: the
+** callback runs at most once per poll, normally posting a whole batch of
+** buffers from an application-managed free ring.
+*/
+extern int ef_vi_receive_set_refill(ef_vi* vi, unsigned threshold,
+                                    ef_vi_rx_refill_fn refill_fn,
+                                    void* context);
+
+
 /*! \brief _Deprecated:_ use ef_vi_receive_get_timestamp_with_sync_flags()
 ** instead.
 **
@@ -1488,6 +1580,31 @@ ef_vi_receive_get_user_data(ef_vi* vi, const void* pkt, uint32_t* user_mark,
 extern int ef_vi_receive_unbundle(ef_vi* ep, const ef_event* event,
                                   ef_request_id* ids);
 
+
+/*! \brief Retrieve packet ids for a whole array of events in one pass
+**
+** \param vi       The virtual interface that generated the events.
+** \param evs      The event array, as filled by ef_eventq_poll().
+** \param n_evs    Number of events in the array.
+** \param ids      Output array of request ids.  Must have space for
+**                  EF_VI_RECEIVE_BATCH ids per RX_MULTI event in the
+**                  array.
+** \param ev_n_ids If non-NULL, receives the number of ids contributed
+**                  by each event (0 for non-RX_MULTI events), so callers
+**                  can attribute ids back to per-event metadata.
+**
+** \return The total number of ids written.
+**
+** Walks the event array once, unbundling every RX_MULTI /
+** RX_MULTI_DISCARD event into a single flat id array.  Equivalent to
+** calling ef_vi_receive_unbundle() per event, with the loop and
+** bookkeeping done once on behalf of the caller.  Events of other
+** types are skipped and report 0 ids.
+*/
+extern int ef_vi_receive_unbundle_batch(ef_vi* vi, const ef_event* evs,
+                                        int n_evs, ef_request_id* ids,
+                                        int* ev_n_ids);
+
 extern ef_request_id ef_vi_rxq_next_desc_id(ef_vi* vi);
 
 
@@ -1508,6 +1625,22 @@ extern void efct_vi_rxpkt_get(ef_vi* vi, uint32_t pkt_id,
                               const void** pkt_start);
 extern void efct_vi_rxpkt_release(ef_vi* vi, uint32_t pkt_id);
 
+/*! \brief Take an additional reference to a received packet's superbuf
+**
+** \param vi     The virtual interface that received the packet.
+** \param pkt_id Packet id, as obtained from efct_vi_rxpkt_get().
+**
+** Pins the superbuf containing the packet beyond the normal rollover
+** horizon, so the payload can be handed to another thread (eg. a slow
+** consumer) without copying it out.  Each retain must be balanced by an
+** extra efct_vi_rxpkt_release(); the superbuf is only returned to the
+** hardware pool when all references have gone.  The hardware keeps
+** receiving into replacement superbufs meanwhile, but the pool is
+** finite: holding large numbers of superbufs for long periods will
+** eventually stall reception.
+*/
+extern void efct_vi_rxpkt_retain(ef_vi* vi, uint32_t pkt_id);
+
 
 /**********************************************************************
  * Transmit interface *************************************************
@@ -1759,6 +1892,37 @@ extern int ef_vi_transmit_init(ef_vi* vi, ef_addr addr, int bytes,
   (vi)->ops.transmitv((vi), (iov), (iov_len), (dma_id))
 
 
+/*! \brief Transmit a batch of packets with a single doorbell
+**
+** \param vi       The virtual interface for which to initialize and push
+**                 TX descriptors.
+** \param iov      Start of the iovec array describing the packet buffers
+**                 for all packets in the batch, with the buffers for each
+**                 packet contiguous in the array.
+** \param iov_lens Array giving the number of iovecs making up each packet.
+** \param dma_ids  Array of DMA ids, one per packet. These are completely
+**                 arbitrary, and can be used for subsequent tracking of
+**                 buffers.
+** \param n_pkts   Number of packets in the batch.
+**
+** \return The number of packets queued on success (which may be fewer than
+**         n_pkts if the descriptor ring fills), or a negative error code:\n
+**         -EAGAIN if no packet could be queued because the descriptor ring
+**         is full.
+**
+** Initialize TX descriptors on the TX descriptor ring for each packet in
+** the batch, then submit them all to the NIC with a single doorbell. When
+** many small packets are ready at once this amortizes the cost of the
+** doorbell write sequence over the whole batch, which is substantially
+** cheaper than calling ef_vi_transmit() per packet.
+**
+** Packets queued by this call complete individually, each with its own
+** dma_id, exactly as if they had been submitted separately.
+*/
+#define ef_vi_transmitv_batch(vi, iov, iov_lens, dma_ids, n_pkts)       \
+  (vi)->ops.transmitv_batch((vi), (iov), (iov_lens), (dma_ids), (n_pkts))
+
+
 /*! \brief Transmit a packet already resident in Programmed I/O
 **
 ** \param vi     The virtual interface from which to transmit.
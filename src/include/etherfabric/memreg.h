@@ -76,6 +76,48 @@ extern int ef_memreg_alloc(ef_memreg* mr, ef_driver_handle mr_dh,
                            struct ef_pd* pd, ef_driver_handle pd_dh,
                            void* p_mem, size_t len_bytes);
 
+
+/*! \brief Flags for ef_memreg_alloc_flags() */
+enum ef_memreg_flags {
+  /** Default behaviour, as ef_memreg_alloc() */
+  EF_MEMREG_DEFAULT     = 0x0,
+  /** Register at the granularity of the backing pages.  If the region is
+  ** backed by 2MB or 1GB hugetlb pages (or is already THP-backed), chunks
+  ** are aligned to the backing page size so the driver can use large NIC
+  ** DMA translation entries; otherwise transparent huge pages are
+  ** requested for the region before it is pinned. */
+  EF_MEMREG_LARGE_PAGES = 0x1,
+  /** Bind the region to the NUMA node of the protection domain's
+  ** interface before it is pinned */
+  EF_MEMREG_BIND_NUMA   = 0x2,
+};
+
+
+/*! \brief Register a memory region for use with ef_vi, with flags
+**
+** \param mr        The ef_memreg object to initialize.
+** \param mr_dh     Driver handle for the ef_memreg.
+** \param pd        Protection domain in which to register memory.
+** \param pd_dh     Driver handle for the protection domain.
+** \param p_mem     Start of memory region to be registered. This must be
+**                  page-aligned, and so be on a 4K boundary.  For
+**                  EF_MEMREG_LARGE_PAGES to take effect it must be
+**                  aligned to the backing page size.
+** \param len_bytes Length of memory region to be registered.
+** \param flags     Flags from ef_memreg_flags.
+**
+** \return 0 on success, or a negative error code.
+**
+** As ef_memreg_alloc(), but with control over how the region is treated
+** before it is pinned.  Large packet arenas should be allocated from
+** hugetlb pages and registered with EF_MEMREG_LARGE_PAGES, which greatly
+** reduces the number of NIC DMA translation entries consumed.
+*/
+extern int ef_memreg_alloc_flags(ef_memreg* mr, ef_driver_handle mr_dh,
+                                 struct ef_pd* pd, ef_driver_handle pd_dh,
+                                 void* p_mem, size_t len_bytes,
+                                 enum ef_memreg_flags flags);
+
 /*! \brief Unregister a memory region
 **
 ** \param mr    The ef_memreg object to unregister.
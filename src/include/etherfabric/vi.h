@@ -350,6 +350,55 @@ extern int ef_vi_set_alloc_from_pd(ef_vi_set* vi_set,
 extern int ef_vi_set_free(ef_vi_set* vi_set, ef_driver_handle vi_set_dh);
 
 
+/** Number of entries in an RSS indirection table */
+#define EF_VI_RSS_INDIRECTION_TABLE_LEN  128
+/** Number of bytes in an RSS (Toeplitz) hash key */
+#define EF_VI_RSS_HASH_KEY_LEN           40
+
+
+/*! \brief Query the RSS spread of a virtual interface set
+**
+** \param vi_set    The virtual interface set to query.
+** \param vi_set_dh The ef_driver_handle of the virtual interface set.
+** \param indir_out Receives the indirection table; must have space for
+**                  EF_VI_RSS_INDIRECTION_TABLE_LEN entries.
+** \param key_out   Receives the hash key; must have space for
+**                  EF_VI_RSS_HASH_KEY_LEN bytes.
+**
+** \return 0 on success, or a negative error code:\n
+**         -ENOENT if the set has no RSS context (eg. a single-VI set).
+**
+** Retrieve the indirection table and Toeplitz hash key currently
+** programmed for the virtual interface set.  Indirection table entries
+** are VI indices within the set.
+*/
+extern int ef_vi_set_query_rss(ef_vi_set* vi_set, ef_driver_handle vi_set_dh,
+                               uint32_t* indir_out, uint8_t* key_out);
+
+
+/*! \brief Rewrite the RSS spread of a live virtual interface set
+**
+** \param vi_set    The virtual interface set to update.
+** \param vi_set_dh The ef_driver_handle of the virtual interface set.
+** \param indir     New indirection table of
+**                  EF_VI_RSS_INDIRECTION_TABLE_LEN entries, each a VI
+**                  index within the set.
+** \param key       New hash key of EF_VI_RSS_HASH_KEY_LEN bytes.
+**
+** \return 0 on success, or a negative error code:\n
+**         -EINVAL if a table entry is out of range\n
+**         -ENOENT if the set has no RSS context.
+**
+** Reprogram the indirection table and Toeplitz hash key of the virtual
+** interface set without tearing down any VIs or filters.  This can be
+** used to rebalance flows across polling threads at runtime, for example
+** to drain a hot queue.  Packets already received to the old spread are
+** unaffected; subsequent packets hash to the new spread.
+*/
+extern int ef_vi_set_update_rss(ef_vi_set* vi_set, ef_driver_handle vi_set_dh,
+                                const uint32_t* indir, const uint8_t* key);
+
+
 /*! \brief Allocate a virtual interface from a virtual interface set
 **
 ** \param vi              Memory for the allocated virtual interface.
@@ -16,6 +16,7 @@
 
 #include <sys/types.h>
 #include <stdint.h>
+#include <string.h>
 #include <onload/extensions_timestamping.h>
 
 #ifdef __cplusplus
@@ -204,6 +205,23 @@ enum onload_spin_type {
 /* Enable or disable spinning for the current thread. */
 extern int onload_thread_set_spin(enum onload_spin_type type, int spin);
 
+/* Per-socket control of spin time.
+ *
+ * In addition to the process-wide EF_SPIN/EF_POLL_USEC options and the
+ * per-thread control above, the spin duration can be set per socket with
+ * the standard SO_BUSY_POLL socket option:
+ *
+ *   int usec = 50;    // spin for up to 50us before blocking
+ *   setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec));
+ *
+ * A value of INT_MAX means spin indefinitely; 0 restores blocking
+ * behaviour.  This lets a single process spin hard on its
+ * latency-critical sockets while its bulk sockets block, without
+ * splitting the sockets across processes.  Spinning must be enabled for
+ * the calling thread (via the environment options or
+ * onload_thread_set_spin()) for the per-socket value to take effect.
+ */
+
 /* Query thread spin settings. The state parameter will be set as a
  *  bitmask of the spin settings */
 extern int onload_thread_get_spin(unsigned* state);
@@ -247,6 +265,15 @@ extern int onload_fd_check_feature(int fd, enum onload_fd_feature feature);
  *
  * Returns 0 f moved successfully, -1 otherwise.
  * In any case, fd is a good accelerated socket after this call.
+ *
+ * Note on migrating flows between SO_REUSEPORT cluster members: moving a
+ * connection to another worker's stack is done by selecting that stack
+ * (onload_set_stackname()) and calling onload_move_fd(); the connection's
+ * full-match hardware filter follows the socket.  Re-steering only the
+ * hardware filter to a different cluster member, leaving the socket
+ * behind, is deliberately not offered: cluster members do not share
+ * socket state, so packets delivered to a stack that does not own the
+ * socket cannot be processed there and would fall through to the kernel.
  */
 extern int onload_move_fd(int fd);
 
@@ -571,6 +598,45 @@ onload_delegated_send_tcp_advance(struct onload_delegated_send* ds, int bytes)
 }
 
 
+/* Prepare headers for a whole burst of delegated-send segments in one
+ * call.
+ *
+ * For each of the n_pkts segments, the current headers are copied into
+ * the caller-provided slot headers[i] (each slot must have room for
+ * ds->headers_len bytes), the copy's IP length and PSH flag are set for
+ * a payload of bytes[i] (PSH only on the last segment, when push_last
+ * is non-zero), and the sequence state in *ds is advanced.  On return
+ * every slot holds a ready-to-send header -- suitable for a CTPIO or
+ * PIO burst -- and *ds reflects the whole burst, ready for
+ * onload_delegated_send_complete().
+ *
+ * This is purely a convenience over calling tcp_update/tcp_advance per
+ * segment: like them it is header arithmetic in the caller's memory,
+ * with no call into Onload.  The caller remains responsible for
+ * respecting mss/send_wnd/cong_wnd for every segment.
+ */
+
+static inline void
+onload_delegated_send_tcp_burst(struct onload_delegated_send* ds,
+                                void* const* headers, const int* bytes,
+                                int n_pkts, int/*bool*/ push_last)
+{
+  void* saved_headers = ds->headers;
+  int i;
+
+  for( i = 0; i < n_pkts; ++i ) {
+    memcpy(headers[i], ds->headers, ds->headers_len);
+    ds->headers = headers[i];
+    onload_delegated_send_tcp_update(ds, bytes[i],
+                                     push_last && i == n_pkts - 1);
+    /* Advance operates on the base headers, so the next copy (and any
+     * later per-segment calls) start from the advanced sequence. */
+    ds->headers = saved_headers;
+    onload_delegated_send_tcp_advance(ds, bytes[i]);
+  }
+}
+
+
 /* Notify Onload that some data have been sent via delegated sends.
  * If successful, Onload will handle all further aspects of the TCP
  * protocol (e.g. acknowledgements, retransmissions) for those bytes.
@@ -208,6 +208,13 @@ extern int onload_zc_buffer_decref(int fd, onload_zc_handle buf);
  * when this registered region is to be used, and can be passed to
  * onload_zc_unregister_buffers() to unregister the buffers.
  */
+/* On a separate "buffer pool object": registered regions already behave
+ * as one.  The handle returned here stands for the whole arena; sends
+ * reference arbitrary extents of it by setting onload_zc_iovec::buf to
+ * the handle and iov_ptr/iov_len64 to the extent, and the stack builds
+ * descriptors pointing into the registered memory without copying into
+ * packet buffers.  A distinct pool type would duplicate this object
+ * with a second registration path. */
 extern int onload_zc_register_buffers(int fd,
                                       ef_addrspace addr_space,
                                       uint64_t base_ptr, uint64_t len,
@@ -523,8 +530,32 @@ extern int onload_zc_send(struct onload_zc_mmsg* msgs, int mlen, int flags);
  */
 
 
+/* onload_zc_send_completions: batched retrieval of send completions.
+ *
+ * Drains up to [n] completed-send cookies (the onload_zc_iovec::app_cookie
+ * values from earlier onload_zc_send() calls using registered buffers)
+ * into [app_cookies], without the caller having to assemble msghdr/cmsg
+ * structures for the error queue.  The drain is performed entirely at
+ * user level and does not block.
+ *
+ * Returns the number of cookies retrieved (which may be 0 if no sends
+ * have completed since the last call), or a negative error code.
+ *
+ * This is a convenience over the error-queue mechanism described above
+ * and has the same semantics, including the caveats around close().
+ * Callers that also want transmit timestamps should drain the error
+ * queue directly with recvmsg(MSG_ERRQUEUE) instead, as the timestamp
+ * cmsgs are discarded by this function.
+ *
+ * A single drain of the error queue can surface the cookies of one
+ * completed send, which cannot be pushed back, so [n] must be at least
+ * ONLOAD_ZC_COMPLETIONS_MIN (the largest number of zero-copy segments
+ * one send packet can carry); -EINVAL is returned otherwise.
+ */
+#define ONLOAD_ZC_COMPLETIONS_MIN 8
+extern int onload_zc_send_completions(int fd, void** app_cookies, int n);
 /******************************************************************************
- * Receive filtering 
+ * Receive filtering
  ******************************************************************************/
 
 /*
@@ -733,6 +764,25 @@ extern int onload_zc_hlrx_free(struct onload_zc_hlrx* hlrx);
  */
 extern int onload_zc_hlrx_buffer_release(int fd, onload_zc_handle buf);
 
+/* As onload_zc_hlrx_buffer_release(), for a batch of buffers.  Local
+ * buffers whose reference count drops to zero are freed back to the
+ * stack in bulk, so releasing the extents consumed by a parsing pass
+ * costs one API crossing instead of one per chunk.
+ *
+ * Note that onload_zc_hlrx_recv_zc() already fills as many iovecs as
+ * are available and fit in one call, so the pair together allow a
+ * gather-parse-release cycle with a single call at each end.
+ *
+ * Returns the number of leading entries fully released (n on complete
+ * success).  On partial failure the remaining entries -- those at and
+ * beyond the returned count -- are left exactly as they were before
+ * the call (references restored, remote buffers unmarked), so the
+ * caller may retry by passing bufs + ret, n - ret.  If no entries
+ * could be released, a negative error code is returned.
+ */
+extern int onload_zc_hlrx_buffer_release_n(int fd, onload_zc_handle* bufs,
+                                           int n);
+
 /* Performs a copying receive on an hlrx state. This function operates
  * identically to recvmsg(), however it returns errors by return code
  * rather than by errno.
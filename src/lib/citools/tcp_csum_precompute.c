@@ -19,7 +19,10 @@
 
 unsigned ci_tcp_csum_precompute(const ci_ip4_hdr* ip, const ci_tcp_hdr* tcp)
 {
-  ci_ip4_pseudo_hdr ph;
+  /* Zero the whole pseudo-header: only [zero] and [ip_protocol] are
+   * read back, but gcc's uninitialised-use analysis cannot see that
+   * through the ci_uint16* access. */
+  ci_ip4_pseudo_hdr ph = {0};
   const ci_uint16* p;
   unsigned csum;
 
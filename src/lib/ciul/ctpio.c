@@ -127,6 +127,15 @@ int ef_vi_ctpio_init(ef_vi* vi)
     }
   }
 
+  {
+    /* The adaptive CTPIO controller is opt-in: it assumes the VI's send
+     * pattern is CTPIO-dominated and changes behaviour under sustained
+     * fallback, so existing deployments keep the old behaviour unless
+     * they ask. */
+    const char* s = getenv("EF_VI_CTPIO_ADAPTIVE");
+    vi->vi_ctpio_adaptive = s != NULL && atoi(s) != 0;
+  }
+
   {
     const char* s = getenv("EF_VI_CTPIO_WB_TICKS");
     if( s != NULL ) {
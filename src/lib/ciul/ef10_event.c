@@ -407,6 +407,9 @@ static void ef10_tx_event_ts_enabled(ef_vi* evq, const ef_vi_event* ev,
   switch( ev_type ) {
   case TX_TIMESTAMP_EVENT_TX_EV_COMPLETION:
   case TX_TIMESTAMP_EVENT_TX_EV_CTPIO_COMPLETION:
+    if( evq->vi_ctpio_adaptive )
+      ef_vi_ctpio_adapt_tx_completion(evq, ev_type ==
+                                      TX_TIMESTAMP_EVENT_TX_EV_CTPIO_COMPLETION);
     break;
   case TX_TIMESTAMP_EVENT_TX_EV_TSTAMP_LO:
   case TX_TIMESTAMP_EVENT_TX_EV_CTPIO_TS_LO:
@@ -450,6 +453,9 @@ static inline void ef10_tx_event_completion(ef_vi* evq, const ef_vi_event* ev,
     ev_out->tx.flags = EF_EVENT_FLAG_CTPIO;
   else
     ev_out->tx.flags = 0;
+  if( evq->vi_ctpio_adaptive )
+    ef_vi_ctpio_adapt_tx_completion(evq, ev_out->tx.flags &
+                                    EF_EVENT_FLAG_CTPIO);
 }
 
 
@@ -852,7 +858,9 @@ static void ef10_mcdi_event(ef_vi* evq, const ef_vi_event* ev,
 int ef10_ef_eventq_poll(ef_vi* evq, ef_event* evs, int evs_len)
 {
   int evs_len_orig = evs_len;
-  ef_vi_event *pev, ev;
+  ef_vi_event batch[EF_VI_EVS_PER_CACHE_LINE];
+  ef_vi_event ev;
+  int n, i, line_full;
   static int overflow_logged = 0;
 
   EF_VI_BUG_ON(evs == NULL);
@@ -862,61 +870,84 @@ int ef10_ef_eventq_poll(ef_vi* evq, ef_event* evs, int evs_len)
     goto overflow;
 
  not_empty:
-  /* Read the event out of the ring, then fiddle with copied version.
-   * Reason is that the ring is likely to get pushed out of cache by
-   * another event being delivered by hardware.
+  /* Read events out of the ring a cacheline at a time, then fiddle with
+   * the copied versions.  Reason is that the ring is likely to get pushed
+   * out of cache by another event being delivered by hardware, and under
+   * burst load checking the phase of the whole block up-front lets us
+   * decode without touching the line again.
    */
-  pev = EF_VI_EVENT_PTR(evq, 0);
-  ev = *pev;
-  if (!EF_VI_IS_EVENT(&ev))
-    goto empty;
   do {
-    /* Ugly: Exploit the fact that event code lies in top bits
-     * of event. */
-    BUG_ON(ESF_DZ_EV_CODE_LBN < 32u);
-    switch( CI_QWORD_FIELD(ev, ESF_DZ_EV_CODE) ) {
-    case ESE_DZ_EV_CODE_RX_EV:
-      ef10_rx_event(evq, &ev, &evs, &evs_len);
-      break;
-
-    case ESE_DZ_EV_CODE_TX_EV:
-      ef10_tx_event(evq, &ev, &evs, &evs_len);
-      break;
-
-    case ESE_DZ_EV_CODE_MCDI_EV:
-      /* Do not process MCDI events if we have
-       * already delivered other events to the
-       * app */
-      if (evs_len != evs_len_orig)
-        goto out;
-      ef10_mcdi_event(evq, &ev, &evs, &evs_len);
-      break;
+    /* Number of events left in the current cacheline of the ring.  The
+     * ring size is a multiple of the cacheline size, so the block never
+     * wraps.
+     */
+    int n_line = EF_VI_EVS_PER_CACHE_LINE -
+      ((EF_VI_EVENT_OFFSET(evq, 0) / EF_VI_EV_SIZE) &
+       (EF_VI_EVS_PER_CACHE_LINE - 1));
 
-    case ESE_DZ_EV_CODE_DRIVER_EV:
-      if (QWORD_GET_U(ESF_DZ_DRV_SUB_CODE, ev) ==
-          ESE_DZ_DRV_START_UP_EV)
-        /* Ignore. */
+    for( n = 0; n < n_line; ++n ) {
+      batch[n] = *EF_VI_EVENT_PTR(evq, n);
+      if( ! EF_VI_IS_EVENT(&batch[n]) )
         break;
-      ci_fallthrough;
-    default:
-      ef_log("%s: ERROR: event type=%u ev="CI_QWORD_FMT,
-             __FUNCTION__,
-             (unsigned) CI_QWORD_FIELD(ev, ESF_DZ_EV_CODE),
-             CI_QWORD_VAL(ev));
-      break;
     }
+    if( n == 0 ) {
+      if( evs_len != evs_len_orig )
+        goto out;
+      goto empty;
+    }
+    line_full = n == n_line;
+    if( line_full )
+      /* More events likely follow in the next cacheline; start pulling
+       * it in while we decode this block.
+       */
+      __builtin_prefetch(EF_VI_EVENT_PTR(evq, n_line));
+
+    for( i = 0; i < n; ++i ) {
+      ev = batch[i];
+      /* Ugly: Exploit the fact that event code lies in top bits
+       * of event. */
+      BUG_ON(ESF_DZ_EV_CODE_LBN < 32u);
+      switch( CI_QWORD_FIELD(ev, ESF_DZ_EV_CODE) ) {
+      case ESE_DZ_EV_CODE_RX_EV:
+        ef10_rx_event(evq, &ev, &evs, &evs_len);
+        break;
+
+      case ESE_DZ_EV_CODE_TX_EV:
+        ef10_tx_event(evq, &ev, &evs, &evs_len);
+        break;
 
-    /* Consume event.  Must do after event checking above,
-     * in case we don't want to consume it. */
-    CI_SET_QWORD(*EF_VI_EVENT_PTR(evq, evq->ep_state->evq.evq_clear_stride));
-    evq->ep_state->evq.evq_ptr += sizeof(ef_vi_event);
+      case ESE_DZ_EV_CODE_MCDI_EV:
+        /* Do not process MCDI events if we have
+         * already delivered other events to the
+         * app */
+        if (evs_len != evs_len_orig)
+          goto out;
+        ef10_mcdi_event(evq, &ev, &evs, &evs_len);
+        break;
 
-    if (evs_len == 0)
-      break;
+      case ESE_DZ_EV_CODE_DRIVER_EV:
+        if (QWORD_GET_U(ESF_DZ_DRV_SUB_CODE, ev) ==
+            ESE_DZ_DRV_START_UP_EV)
+          /* Ignore. */
+          break;
+        ci_fallthrough;
+      default:
+        ef_log("%s: ERROR: event type=%u ev="CI_QWORD_FMT,
+               __FUNCTION__,
+               (unsigned) CI_QWORD_FIELD(ev, ESF_DZ_EV_CODE),
+               CI_QWORD_VAL(ev));
+        break;
+      }
 
-    pev = EF_VI_EVENT_PTR(evq, 0);
-    ev = *pev;
-  } while (EF_VI_IS_EVENT(&ev));
+      /* Consume event.  Must do after event checking above,
+       * in case we don't want to consume it. */
+      CI_SET_QWORD(*EF_VI_EVENT_PTR(evq, evq->ep_state->evq.evq_clear_stride));
+      evq->ep_state->evq.evq_ptr += sizeof(ef_vi_event);
+
+      if (evs_len == 0)
+        goto out;
+    }
+  } while( line_full );
 
  out:
   return evs_len_orig - evs_len;
@@ -280,6 +280,33 @@ static int ef10_ef_vi_transmitv(ef_vi* vi, const ef_iovec* iov, int iov_len,
 }
 
 
+static int ef10_ef_vi_transmitv_batch(ef_vi* vi, const ef_iovec* iov,
+                                      const int* iov_lens,
+                                      const ef_request_id* dma_ids,
+                                      int n_pkts)
+{
+  int i, rc = 0;
+
+  EF_VI_BUG_ON(n_pkts <= 0);
+
+  /* Write descriptors for as many packets as will fit, then ring the
+   * doorbell once for the lot.  Each packet keeps its own dma_id, so
+   * completions are reported exactly as for individual sends.
+   */
+  for( i = 0; i < n_pkts; ++i ) {
+    rc = ef10_ef_vi_transmitv_init(vi, iov, iov_lens[i], dma_ids[i]);
+    if( rc < 0 )
+      break;
+    iov += iov_lens[i];
+  }
+  if( i == 0 )
+    return rc;
+  wmb();
+  ef10_ef_vi_transmit_push(vi);
+  return i;
+}
+
+
 ef_vi_inline void
 ef10_pio_set_desc(ef_vi* vi, ef_vi_txq* q, ef_vi_txq_state* qs,
                   int offset, int len, ef_request_id dma_id)
@@ -468,6 +495,28 @@ static inline __attribute__((always_inline)) void
   EF_VI_ASSERT( vi->vi_ctpio_mmap_ptr != NULL );
   EF_VI_ASSERT( frame_len == iovec_bytes(iov, iovcnt) );
 
+  if(unlikely( vi->vi_ctpio_adaptive )) {
+    if( vi->vi_ctpio_suppress_n > 0 ) {
+      /* The adaptive controller has decided CTPIO attempts are currently
+       * futile: skip the aperture write and let the DMA fallback
+       * descriptor do the send.  The copy-to-fallback contract must
+       * still be honoured.
+       */
+      int i;
+      char* p = fallback;
+      --vi->vi_ctpio_suppress_n;
+      if( vi->vi_stats != NULL )
+        ++vi->vi_stats->ctpio_suppressed;
+      if( copy_to_fallback )
+        for( i = 0; i < iovcnt; ++i ) {
+          memcpy(p, iov[i].iov_base, iov[i].iov_len);
+          p += iov[i].iov_len;
+        }
+      return;
+    }
+    ef_vi_ctpio_adapt_attempt(vi);
+  }
+
   CI_POPULATE_DWORD_3(header,
                       ESF_FZ_USER_THRESHOLD, threshold,
                       ESF_FZ_TIME_STAMP_REQ, time_stamp_req,
@@ -776,6 +825,7 @@ static void ef10_vi_initialise_ops(ef_vi* vi)
 {
   vi->ops.transmit               = ef10_ef_vi_transmit;
   vi->ops.transmitv              = ef10_ef_vi_transmitv;
+  vi->ops.transmitv_batch        = ef10_ef_vi_transmitv_batch;
   vi->ops.transmitv_init         = ef10_ef_vi_transmitv_init;
   vi->ops.transmit_push          = ef10_ef_vi_transmit_push;
   vi->ops.transmit_pio           = ef10_ef_vi_transmit_pio;
@@ -213,7 +213,53 @@
 #define EF_VI_EV_DRIVER_SUBTYPE_MEMCPY_SYNC       15
 
 
-/* ******************************************************************** 
+/**********************************************************************
+ * Adaptive CTPIO controller (opt-in via EF_VI_CTPIO_ADAPTIVE).
+ *
+ * Attempts are counted at send time, successes at completion time via
+ * EF_EVENT_FLAG_CTPIO.  Classifying this way means plain DMA/PIO sends
+ * interleaved on the same VI are invisible to the controller (their
+ * completions carry no CTPIO flag and are simply not accounted), and
+ * suppressed sends cannot re-arm the suppression (they make no attempt
+ * and their completions are unflagged).  When a window of attempts
+ * shows almost no successes -- eg. under link congestion, where every
+ * aperture write is wasted WC-buffer bandwidth -- further attempts are
+ * suppressed for a while and the DMA fallback descriptor does the
+ * send, before attempting again.
+ */
+
+#define EF_VI_CTPIO_ADAPT_WIN         256
+#define EF_VI_CTPIO_ADAPT_MIN_OK      (EF_VI_CTPIO_ADAPT_WIN / 8)
+#define EF_VI_CTPIO_ADAPT_SUPPRESS_N  4096
+
+/* Record a CTPIO attempt and evaluate the window. */
+ef_vi_inline void ef_vi_ctpio_adapt_attempt(ef_vi* vi)
+{
+  if( ++vi->vi_ctpio_attempts_in_win >= EF_VI_CTPIO_ADAPT_WIN ) {
+    uint16_t ok = vi->vi_ctpio_ok_in_win;
+    if( ok < EF_VI_CTPIO_ADAPT_MIN_OK )
+      vi->vi_ctpio_suppress_n = EF_VI_CTPIO_ADAPT_SUPPRESS_N;
+    if( vi->vi_stats != NULL )
+      vi->vi_stats->ctpio_fallback += EF_VI_CTPIO_ADAPT_WIN -
+        (ok > EF_VI_CTPIO_ADAPT_WIN ? EF_VI_CTPIO_ADAPT_WIN : ok);
+    vi->vi_ctpio_ok_in_win = 0;
+    vi->vi_ctpio_attempts_in_win = 0;
+  }
+}
+
+/* Record an observed CTPIO success (a TX completion carrying
+ * EF_EVENT_FLAG_CTPIO). */
+ef_vi_inline void ef_vi_ctpio_adapt_tx_completion(ef_vi* vi, int ctpio_ok)
+{
+  if( ctpio_ok ) {
+    ++vi->vi_ctpio_ok_in_win;
+    if( vi->vi_stats != NULL )
+      ++vi->vi_stats->ctpio_success;
+  }
+}
+
+
+/* ********************************************************************
  */
 
 extern void ef10_vi_init(ef_vi*) EF_VI_HF;
@@ -735,8 +735,21 @@ static int efct_ef_eventq_poll_1rxtx(ef_vi* vi, ef_event* evs, int evs_len)
 static int efct_ef_eventq_poll_generic(ef_vi* vi, ef_event* evs, int evs_len)
 {
   int i, n = 0;
-  for( i = 0; i < vi->max_efct_rxq; ++i )
-    n += efct_poll_rx(vi, i, evs + n, evs_len - n);
+  unsigned first = vi->efct_poll_rr;
+
+  /* Rotate which queue is polled first so that a queue receiving at
+   * line rate cannot monopolise the front of every poll and starve the
+   * queues after it; each queue periodically gets first claim on the
+   * event budget. */
+  if( ++vi->efct_poll_rr >= (unsigned) vi->max_efct_rxq )
+    vi->efct_poll_rr = 0;
+
+  for( i = 0; i < vi->max_efct_rxq; ++i ) {
+    unsigned qid = first + i;
+    if( qid >= (unsigned) vi->max_efct_rxq )
+      qid -= vi->max_efct_rxq;
+    n += efct_poll_rx(vi, qid, evs + n, evs_len - n);
+  }
   if( vi->vi_txq.mask )
     n += efct_poll_tx(vi, evs + n, evs_len - n);
   return n;
@@ -1022,6 +1035,18 @@ void efct_vi_rxpkt_release(ef_vi* vi, uint32_t pkt_id)
                   pkt_id_to_local_superbuf_ix(pkt_id));
 }
 
+void efct_vi_rxpkt_retain(ef_vi* vi, uint32_t pkt_id)
+{
+  struct efct_rx_descriptor* desc = efct_rx_desc(vi, pkt_id);
+
+  EF_VI_ASSERT(vi->nic_type.arch == EF_VI_ARCH_EFCT);
+  /* Legal only while the caller already holds a reference, ie. between
+   * the packet event and its release. */
+  EF_VI_ASSERT(desc->refcnt > 0);
+  EF_VI_ASSERT(desc->refcnt < (uint16_t) -1);
+  ++desc->refcnt;
+}
+
 int efct_ef_eventq_check_event(const ef_vi* vi)
 {
   return efct_tx_check_event(vi) || efct_rx_check_event(vi);
@@ -220,12 +220,93 @@ static inline volatile uint64_t*
   return __memcpy_iov_to_pio(dst, &iov, 1, aligned, 0);
 }
 
+#if !defined(__KERNEL__) && defined(__x86_64__)
+#include <immintrin.h>
+
+/* Fixed-size copy of a whole number of write-combining buffers.  With a
+ * compile-time constant [len] the loops below unroll completely, giving
+ * straight-line 64/128/256-byte variants without a separate function for
+ * each size; the memcpy_to_pio* macros select this at compile time per
+ * call site.  Source alignment is not required (loads go via memcpy);
+ * stores remain naturally aligned 64-bit writes as the aperture demands.
+ */
+static inline __attribute__((always_inline)) volatile uint64_t*
+__memcpy_to_pio_fixed(volatile uint64_t* dst, const void* src, size_t len)
+{
+  const char* s = src;
+  size_t i;
+
+  for( i = 0; i < len; i += sizeof(uint64_t) ) {
+    uint64_t w;
+    memcpy(&w, s + i, sizeof(w));
+    *dst++ = w;
+  }
+  wmb_wc();
+  return dst;
+}
+
+/* As __memcpy_to_pio_fixed, but with non-temporal stores and a single
+ * sfence.  Useful for larger writes where we don't want the source's
+ * cachelines hanging around, eg. bulk template updates.
+ */
+static inline __attribute__((always_inline)) volatile uint64_t*
+__memcpy_to_pio_fixed_nt(volatile uint64_t* dst, const void* src, size_t len)
+{
+  const char* s = src;
+  size_t i;
+
+#ifdef __AVX512F__
+  /* Whole write-buffers at a time when the translation unit is built
+   * with AVX-512 enabled. */
+  if( (len & (EF_VI_WRITE_BUFFER_SIZE - 1)) == 0 &&
+      ((uintptr_t) dst & (EF_VI_WRITE_BUFFER_SIZE - 1)) == 0 ) {
+    for( i = 0; i < len; i += 64 )
+      _mm512_stream_si512((void*) ((char*) dst + i),
+                          _mm512_loadu_si512(s + i));
+    _mm_sfence();
+    return dst + len / sizeof(uint64_t);
+  }
+#endif
+
+  for( i = 0; i < len; i += sizeof(uint64_t) ) {
+    uint64_t w;
+    memcpy(&w, s + i, sizeof(w));
+    _mm_stream_si64((long long*) dst, w);
+    ++dst;
+  }
+  _mm_sfence();
+  return dst;
+}
+
+/* Whole write-buffer copies with compile-time-constant length can use the
+ * fully unrolled variant; everything else takes the generic loop. */
+#define MEMCPY_TO_PIO_IS_FIXED(len)                                     \
+  (__builtin_constant_p(len) && (len) > 0 && (len) <= 256 &&            \
+   ((len) & (EF_VI_WRITE_BUFFER_SIZE - 1)) == 0)
+
+# define memcpy_to_pio(dst, src, len)                                   \
+  (MEMCPY_TO_PIO_IS_FIXED(len) ?                                        \
+   __memcpy_to_pio_fixed((volatile uint64_t*) (dst), (src), (len)) :    \
+   __memcpy_to_pio((dst), (src), (len), 0))
+
+# define memcpy_to_pio_aligned(dst, src, len)                           \
+  (MEMCPY_TO_PIO_IS_FIXED(len) ?                                        \
+   __memcpy_to_pio_fixed((volatile uint64_t*) (dst), (src), (len)) :    \
+   __memcpy_to_pio((dst), (src), (len), 1))
+
+# define memcpy_to_pio_nt(dst, src, len)                                \
+  __memcpy_to_pio_fixed_nt((volatile uint64_t*) (dst), (src), (len))
+
+#else
+
 # define memcpy_to_pio(dst, src, len)           \
        __memcpy_to_pio((dst), (src), (len), 0)
 
 # define memcpy_to_pio_aligned(dst, src, len)   \
        __memcpy_to_pio((dst), (src), (len), 1)
 
+#endif
+
 
 #define CTPIO_COPY_FLUSH()                      \
   do {                                          \
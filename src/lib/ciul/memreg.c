@@ -19,6 +19,90 @@
 #include "driver_access.h"
 #include "logging.h"
 
+#include <etherfabric/internal/efct_uk_api.h>  /* for CI_HUGEPAGE_SIZE */
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/* Avoid a build dependency on libnuma for the one syscall we need. */
+#ifndef MPOL_BIND
+# define MPOL_BIND      2
+#endif
+#ifndef MPOL_MF_MOVE
+# define MPOL_MF_MOVE   (1 << 1)
+#endif
+
+
+/* Returns the size of the pages backing the VMA containing [p], or 0 if
+ * it cannot be determined.  Hugetlb mappings report their page size via
+ * KernelPageSize; THP-backed anonymous memory still reports 4K there, so
+ * treat a VMA with populated AnonHugePages as 2MB-backed.
+ */
+static size_t memreg_backing_page_size(const void* p)
+{
+  FILE* f = fopen("/proc/self/smaps", "r");
+  char line[256];
+  unsigned long start, end, kb;
+  size_t page_size = 0;
+  int in_vma = 0;
+
+  if( f == NULL )
+    return 0;
+  while( fgets(line, sizeof(line), f) != NULL ) {
+    if( sscanf(line, "%lx-%lx ", &start, &end) == 2 ) {
+      if( in_vma )
+        break;
+      in_vma = (uintptr_t) p >= start && (uintptr_t) p < end;
+    }
+    else if( in_vma && sscanf(line, "KernelPageSize: %lu kB", &kb) == 1 ) {
+      if( kb * 1024 > page_size )
+        page_size = kb * 1024;
+    }
+    else if( in_vma && sscanf(line, "AnonHugePages: %lu kB", &kb) == 1 ) {
+      if( kb != 0 && page_size < CI_HUGEPAGE_SIZE )
+        page_size = CI_HUGEPAGE_SIZE;
+    }
+  }
+  fclose(f);
+  return page_size;
+}
+
+
+/* Returns the NUMA node of the PD's interface, or -1 if unknown. */
+static int memreg_intf_numa_node(const ef_pd* pd)
+{
+  char path[128];
+  FILE* f;
+  int node = -1;
+
+  if( pd->pd_intf_name == NULL )
+    return -1;
+  snprintf(path, sizeof(path), "/sys/class/net/%s/device/numa_node",
+           pd->pd_intf_name);
+  f = fopen(path, "r");
+  if( f == NULL )
+    return -1;
+  if( fscanf(f, "%d", &node) != 1 )
+    node = -1;
+  fclose(f);
+  return node;
+}
+
+
+static int memreg_bind_numa(void* base, size_t len, int node)
+{
+  unsigned long nodemask;
+
+  if( node < 0 || node >= (int) (8 * sizeof(nodemask)) )
+    return -EINVAL;
+  nodemask = 1ul << node;
+  if( syscall(__NR_mbind, base, len, MPOL_BIND, &nodemask,
+              8 * sizeof(nodemask), MPOL_MF_MOVE) < 0 )
+    return -errno;
+  return 0;
+}
+
 
 static int memreg_alloc(ef_driver_handle mr_dh,
                         ef_pd* pd, ef_driver_handle pd_dh,
@@ -44,14 +128,51 @@ static int memreg_alloc(ef_driver_handle mr_dh,
 }
 
 
-int ef_memreg_alloc(ef_memreg* mr, ef_driver_handle mr_dh, 
-                    ef_pd* pd, ef_driver_handle pd_dh,
-                    void* p_mem, size_t len_bytes)
+int ef_memreg_alloc_flags(ef_memreg* mr, ef_driver_handle mr_dh,
+                          ef_pd* pd, ef_driver_handle pd_dh,
+                          void* p_mem, size_t len_bytes,
+                          enum ef_memreg_flags flags)
 {
+  size_t backing_page_size = 0;
+
   /* The memory region must be aligned on a 4K boundary. */
   if( ((uintptr_t) p_mem & (EFHW_NIC_PAGE_SIZE - 1)) != 0 )
     return -EINVAL;
 
+  /* NUMA binding and huge page advice must both happen before the pages
+   * are pinned by registration, after which they cannot move.
+   */
+  if( flags & EF_MEMREG_BIND_NUMA ) {
+    int node = memreg_intf_numa_node(pd);
+    if( node >= 0 ) {
+      int rc = memreg_bind_numa(p_mem, len_bytes, node);
+      if( rc < 0 ) {
+        LOGVV(ef_log("%s: ERROR: mbind(%p+%zu, node %d) rc=%d", __func__,
+                     p_mem, len_bytes, node, rc));
+        return rc;
+      }
+    }
+  }
+
+  if( flags & EF_MEMREG_LARGE_PAGES ) {
+    backing_page_size = memreg_backing_page_size(p_mem);
+    if( backing_page_size <= CI_PAGE_SIZE ) {
+      /* Not huge-backed yet: ask for transparent huge pages.  Best
+       * effort; registration proceeds at 4K granularity if the kernel
+       * declines.
+       */
+      madvise(p_mem, len_bytes, MADV_HUGEPAGE);
+      backing_page_size = memreg_backing_page_size(p_mem);
+    }
+    if( backing_page_size > CI_PAGE_SIZE &&
+        ((uintptr_t) p_mem & (backing_page_size - 1)) != 0 ) {
+      LOGVV(ef_log("%s: region %p not aligned to backing page size %zu; "
+                   "registering at 4K granularity", __func__, p_mem,
+                   backing_page_size));
+      backing_page_size = 0;
+    }
+  }
+
   /* Note: At time of writing the driver rounds the registered region to
    * whole system pages.  It then writes a DMA address for each 4K page
    * within the system-aligned region.  This means that on PPC (where
@@ -76,7 +197,13 @@ int ef_memreg_alloc(ef_memreg* mr, ef_driver_handle mr_dh,
   char* chunk_start = p_mem_sys_base;
   char* chunk_end = p_mem_sys_end;
   size_t align = 1 << 22;
-  size_t max_chunk = ((uint64_t) 1u << 32) - align;
+  size_t max_chunk;
+  if( backing_page_size > align )
+    /* Keep chunks aligned to the backing page size so the driver sees
+     * whole huge pages and can use large buffer-table entries.
+     */
+    align = backing_page_size;
+  max_chunk = (((uint64_t) 1u << 32) - align) & ~(align - 1);
   if( chunk_end - chunk_start >= ((uint64_t) 1u << 32) ) {
     chunk_end = chunk_start + max_chunk;
     chunk_end = CI_PTR_ALIGN_BACK(chunk_end, align);
@@ -107,6 +234,15 @@ int ef_memreg_alloc(ef_memreg* mr, ef_driver_handle mr_dh,
 }
 
 
+int ef_memreg_alloc(ef_memreg* mr, ef_driver_handle mr_dh,
+                    ef_pd* pd, ef_driver_handle pd_dh,
+                    void* p_mem, size_t len_bytes)
+{
+  return ef_memreg_alloc_flags(mr, mr_dh, pd, pd_dh, p_mem, len_bytes,
+                               EF_MEMREG_DEFAULT);
+}
+
+
 int ef_memreg_free(ef_memreg* mr, ef_driver_handle mr_dh)
 {
   free(mr->mr_dma_addrs_base);
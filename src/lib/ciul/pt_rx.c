@@ -26,6 +26,62 @@ int ef_vi_receive_post(ef_vi* vi, ef_addr addr, ef_request_id dma_id)
 }
 
 
+int ef_vi_receive_post_batch(ef_vi* vi, const ef_addr* addrs,
+                             const ef_request_id* dma_ids, int n)
+{
+  int i, rc = 0;
+
+  EF_VI_BUG_ON( n <= 0 );
+
+  for( i = 0; i < n; ++i ) {
+    rc = ef_vi_receive_init(vi, addrs[i], dma_ids[i]);
+    if( rc < 0 )
+      break;
+  }
+  if( i == 0 )
+    return rc;
+  ef_vi_receive_push(vi);
+  return i;
+}
+
+
+static int ef_vi_eventq_poll_refill(ef_vi* vi, ef_event* evs, int evs_len)
+{
+  int n = vi->rx_refill_orig_poll(vi, evs, evs_len);
+  if( (unsigned) ef_vi_receive_fill_level(vi) < vi->rx_refill_threshold )
+    vi->rx_refill_fn(vi, vi->rx_refill_context);
+  return n;
+}
+
+
+int ef_vi_receive_set_refill(ef_vi* vi, unsigned threshold,
+                             ef_vi_rx_refill_fn refill_fn, void* context)
+{
+  if( threshold == 0 ) {
+    if( vi->rx_refill_orig_poll != NULL ) {
+      vi->ops.eventq_poll = vi->rx_refill_orig_poll;
+      vi->rx_refill_orig_poll = NULL;
+    }
+    vi->rx_refill_fn = NULL;
+    vi->rx_refill_context = NULL;
+    vi->rx_refill_threshold = 0;
+    return 0;
+  }
+
+  if( refill_fn == NULL || threshold > vi->vi_rxq.mask )
+    return -EINVAL;
+
+  vi->rx_refill_fn = refill_fn;
+  vi->rx_refill_context = context;
+  vi->rx_refill_threshold = threshold;
+  if( vi->rx_refill_orig_poll == NULL ) {
+    vi->rx_refill_orig_poll = vi->ops.eventq_poll;
+    vi->ops.eventq_poll = ef_vi_eventq_poll_refill;
+  }
+  return 0;
+}
+
+
 int ef_vi_receive_unbundle(ef_vi* vi, const ef_event* ev,
                            ef_request_id* ids)
 {
@@ -54,6 +110,24 @@ int ef_vi_receive_unbundle(ef_vi* vi, const ef_event* ev,
 }
 
 
+int ef_vi_receive_unbundle_batch(ef_vi* vi, const ef_event* evs, int n_evs,
+                                 ef_request_id* ids, int* ev_n_ids)
+{
+  int i, total = 0;
+
+  for( i = 0; i < n_evs; ++i ) {
+    int n = 0;
+    if( EF_EVENT_TYPE(evs[i]) == EF_EVENT_TYPE_RX_MULTI ||
+        EF_EVENT_TYPE(evs[i]) == EF_EVENT_TYPE_RX_MULTI_DISCARD )
+      n = ef_vi_receive_unbundle(vi, &evs[i], ids + total);
+    if( ev_n_ids != NULL )
+      ev_n_ids[i] = n;
+    total += n;
+  }
+  return total;
+}
+
+
 int
 ef_vi_receive_get_bytes(ef_vi* vi, const void* pkt, uint16_t* bytes_out)
 {
@@ -223,6 +223,30 @@ int ef_vi_tx_ring_bytes(struct ef_vi* vi)
 }
 
 
+/* Generic transmitv_batch for drivers without a specialised
+ * implementation: queue each packet's descriptors, then push once.
+ */
+static int ef_vi_transmitv_batch_generic(ef_vi* vi, const ef_iovec* iov,
+                                         const int* iov_lens,
+                                         const ef_request_id* dma_ids,
+                                         int n_pkts)
+{
+  int i, rc = 0;
+
+  for( i = 0; i < n_pkts; ++i ) {
+    rc = vi->ops.transmitv_init(vi, iov, iov_lens[i], dma_ids[i]);
+    if( rc < 0 )
+      break;
+    iov += iov_lens[i];
+  }
+  if( i == 0 )
+    return rc;
+  wmb();
+  vi->ops.transmit_push(vi);
+  return i;
+}
+
+
 int ef_vi_init(struct ef_vi* vi, int arch, int variant, int revision,
 	       unsigned ef_vi_flags, unsigned char nic_flags,
 	       ef_vi_state* state)
@@ -260,6 +284,8 @@ int ef_vi_init(struct ef_vi* vi, int arch, int variant, int revision,
   default:
     return -EINVAL;
   }
+  if( vi->ops.transmitv_batch == NULL )
+    vi->ops.transmitv_batch = ef_vi_transmitv_batch_generic;
   vi->inited |= EF_VI_INITED_NIC;
   return 0;
 }
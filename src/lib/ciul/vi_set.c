@@ -74,3 +74,36 @@ int ef_vi_set_free(ef_vi_set* vi_set, ef_driver_handle dh)
 {
   return 0;
 }
+
+
+static int __ef_vi_set_rss_op(ef_vi_set* viset, ef_driver_handle dh,
+                              unsigned op_code, const uint32_t* indir,
+                              const uint8_t* key)
+{
+  ci_resource_op_t op;
+
+  memset(&op, 0, sizeof(op));
+  op.op = op_code;
+  op.id = efch_make_resource_id(viset->vis_res_id);
+  op.u.vi_set_rss.indir_ptr = (uintptr_t) indir;
+  op.u.vi_set_rss.key_ptr = (uintptr_t) key;
+  op.u.vi_set_rss.indir_len = EF_VI_RSS_INDIRECTION_TABLE_LEN;
+  op.u.vi_set_rss.key_len = EF_VI_RSS_HASH_KEY_LEN;
+  return ci_resource_op(dh, &op);
+}
+
+
+int ef_vi_set_query_rss(ef_vi_set* viset, ef_driver_handle dh,
+                        uint32_t* indir_out, uint8_t* key_out)
+{
+  return __ef_vi_set_rss_op(viset, dh, CI_RSOP_VI_SET_GET_RSS,
+                            indir_out, key_out);
+}
+
+
+int ef_vi_set_update_rss(ef_vi_set* viset, ef_driver_handle dh,
+                         const uint32_t* indir, const uint8_t* key)
+{
+  return __ef_vi_set_rss_op(viset, dh, CI_RSOP_VI_SET_UPDATE_RSS,
+                            indir, key);
+}
@@ -1,5 +1,10 @@
 /* SPDX-License-Identifier: GPL-2.0 OR BSD-2-Clause */
 /* X-SPDX-Copyright-Text: (c) Copyright 2019-2020 Xilinx, Inc. */
+
+/* Each fwd row carries its own version word and double-buffered payload
+ * (see cp_fwd_version()), so a reader revalidating a cached route only
+ * retries if its own row changed; the table-level version covers
+ * existence/resize events only. */
 /* mib worker functions for fwd operations in the server.
  * i.e. these functions should not assume that the fwd_table required is in the
  * mib.
@@ -169,6 +169,7 @@ int efrm_vi_set_alloc(struct efrm_pd *pd, int n_vis,
 
 	for (i = 0; i <= EFRM_RSS_MODE_ID_MAX; ++i)
 		vi_set->rss_context[i].rss_context_id = -1;
+	mutex_init(&vi_set->rss_mutex);
 
 	if (!(n_vis > 1 || rss_limited)) {
 		/* Don't bother allocating a context of size 1, just use
@@ -365,6 +366,7 @@ int efrm_vi_set_redistribute_queue(struct efrm_vi_set* vi_set, uint32_t q_id)
 	int i;
 	int rc = 0;
 
+	mutex_lock(&vi_set->rss_mutex);
 	for (i = 0; i <= EFRM_RSS_MODE_ID_MAX; ++i) {
 		if (vi_set->rss_context[i].rss_context_id != -1) {
 			int rc1 = __efrm_vi_set_redistribute_queue(vi_set, i,
@@ -377,6 +379,7 @@ int efrm_vi_set_redistribute_queue(struct efrm_vi_set* vi_set, uint32_t q_id)
 			}
 		}
 	}
+	mutex_unlock(&vi_set->rss_mutex);
 
 	return rc;
 }
@@ -439,6 +442,69 @@ int efrm_vi_set_get_rss_context(struct efrm_vi_set *vi_set, unsigned rss_id)
 EXPORT_SYMBOL(efrm_vi_set_get_rss_context);
 
 
+int efrm_vi_set_get_rss(struct efrm_vi_set *vi_set, unsigned rss_id,
+			uint32_t *indir_out, uint8_t *key_out)
+{
+	struct efrm_rss_context *rss_context;
+
+	if (rss_id > EFRM_RSS_MODE_ID_MAX)
+		return -EINVAL;
+	rss_context = &vi_set->rss_context[rss_id];
+	if (rss_context->rss_context_id == -1)
+		return -ENOENT;
+	if (indir_out != NULL)
+		memcpy(indir_out, rss_context->indirection_table,
+		       sizeof(rss_context->indirection_table));
+	if (key_out != NULL)
+		memcpy(key_out, rss_context->rss_hash_key,
+		       sizeof(rss_context->rss_hash_key));
+	return 0;
+}
+EXPORT_SYMBOL(efrm_vi_set_get_rss);
+
+
+int efrm_vi_set_update_rss(struct efrm_vi_set *vi_set, unsigned rss_id,
+			   const uint32_t *indir, const uint8_t *key)
+{
+	struct efrm_rss_context *rss_context;
+	uint64_t indirected_vis = 0;
+	int index;
+	int rc;
+
+	if (rss_id > EFRM_RSS_MODE_ID_MAX)
+		return -EINVAL;
+	rss_context = &vi_set->rss_context[rss_id];
+	if (rss_context->rss_context_id == -1)
+		return -ENOENT;
+
+	for (index = 0; index < EFRM_RSS_INDIRECTION_TABLE_LEN; index++) {
+		if (indir[index] >= (uint32_t) vi_set->n_vis)
+			return -EINVAL;
+		indirected_vis |= 1ull << indir[index];
+	}
+
+	/* The resource-op path arrives here with no other serialisation,
+	 * so take the set's RSS mutex against concurrent updates and
+	 * against queue redistribution. */
+	mutex_lock(&vi_set->rss_mutex);
+	rc = efrm_rss_context_update(vi_set->rs.rs_client,
+				     rss_context->rss_context_id,
+				     indir, key, rss_context->rss_mode);
+	if (rc == 0) {
+		/* As for queue redistribution: only update our record once
+		 * the NIC has accepted the new table. */
+		memcpy(rss_context->indirection_table, indir,
+		       sizeof(rss_context->indirection_table));
+		memcpy(rss_context->rss_hash_key, key,
+		       sizeof(rss_context->rss_hash_key));
+		rss_context->indirected_vis = indirected_vis;
+	}
+	mutex_unlock(&vi_set->rss_mutex);
+	return rc;
+}
+EXPORT_SYMBOL(efrm_vi_set_update_rss);
+
+
 struct efrm_resource * efrm_vi_set_to_resource(struct efrm_vi_set *vi_set)
 {
 	return &vi_set->rs;
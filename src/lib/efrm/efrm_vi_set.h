@@ -66,6 +66,11 @@ struct efrm_vi_set {
 	struct completion         allocation_completion;
 	uint64_t                  free;
 	struct efrm_rss_context   rss_context[EFRM_RSS_MODE_ID_MAX + 1];
+	/* Serialises mutation of the rss_context state (indirection
+	 * table, key, indirected_vis) and its propagation to the NIC:
+	 * taken by efrm_vi_set_update_rss() and by queue
+	 * redistribution. */
+	struct mutex              rss_mutex;
 	int                       n_vis;
 	int                       n_vis_flushing;
 	int                       n_flushing_waiters;
@@ -139,6 +139,21 @@ static int efab_eplock_is_unlocked_or_request_wake(ci_eplock_t* epl)
   return 0;
 }
 
+/* Re-arm the wake request on behalf of waiters that are still asleep.
+ * Waiters are exclusive, so a wake-up reaches one of them only; the lock
+ * word's NEED_WAKE flag was consumed by the unlock that woke us, and any
+ * remaining sleepers rely on us restoring it before we unlock in turn. */
+static void oo_eplock_rearm_wake(ci_eplock_t* epl)
+{
+  ci_uint64 l;
+  do {
+    l = epl->lock;
+    if( l & CI_EPLOCK_FL_NEED_WAKE )
+      break;
+  } while( ci_cas64u_fail(&epl->lock, l, l | CI_EPLOCK_FL_NEED_WAKE) );
+}
+
+
 /* Returns 0 if lock have been taken; 1 otherwise */
 static int oo_eplock_lock_or_request_wake(ci_eplock_t* epl)
 {
@@ -172,6 +187,12 @@ efab_eplock_lock_wait(ci_netif* ni, int maybe_wedged)
   efab_eplock_record_pid(ni);
 #endif
 
+  /* NB: deliberately a non-exclusive waiter.  Some wake-ups on this
+   * queue are broadcasts meaning "re-check your flags" -- in particular
+   * efab_tcp_helper_flush_reset_wq() must reach the reset-work thread
+   * sleeping here with maybe_wedged set -- so in-kernel waiters must
+   * always see them.  Only the user-level waiters in oo_eplock_lock()
+   * are exclusive. */
   init_waitqueue_entry(&wait, current);
   add_wait_queue(&ni->eplock_helper.wq, &wait);
 
@@ -206,7 +227,7 @@ int oo_eplock_lock(ci_netif* ni, long* timeout_jiffies, int maybe_wedged)
 #endif
 
   init_waitqueue_entry(&wait, current);
-  add_wait_queue(&ni->eplock_helper.wq, &wait);
+  add_wait_queue_exclusive(&ni->eplock_helper.wq, &wait);
 
   while( 1 ) {
     set_current_state(TASK_INTERRUPTIBLE);
@@ -230,6 +251,14 @@ int oo_eplock_lock(ci_netif* ni, long* timeout_jiffies, int maybe_wedged)
 
   remove_wait_queue(&ni->eplock_helper.wq, &wait);
   set_current_state(TASK_RUNNING);
+  if( rc == 0 ) {
+    if( waitqueue_active(&ni->eplock_helper.wq) )
+      oo_eplock_rearm_wake(&ni->state->lock);
+  }
+  else {
+    /* See efab_eplock_lock_wait(): pass a possibly-consumed wake-up on. */
+    wake_up_interruptible(&ni->eplock_helper.wq);
+  }
   return rc;
 }
 
@@ -246,6 +275,7 @@ efab_eplock_lock_timeout(ci_netif* ni, signed long timeout_jiffies)
   if( ef_eplock_trylock(&ni->state->lock) )
     return 0;
 
+  /* Non-exclusive for the same reason as efab_eplock_lock_wait(). */
   init_waitqueue_entry(&wait, current);
   add_wait_queue(&ni->eplock_helper.wq, &wait);
 
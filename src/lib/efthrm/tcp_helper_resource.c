@@ -2179,6 +2179,16 @@ allocate_netif_resources(ci_resource_onload_alloc_t* alloc,
   if( ci_netif_should_allocate_tcp_shared_local_ports(ni) ) {
     no_active_wild_pools = is_power_of_2(cluster_size) ? cluster_size :
                                                          RSS_HASH_SIZE;
+    if( cluster_size == 1 && NI_OPTS(ni).tcp_shared_local_ports_pools > 1 ) {
+      /* Unclustered stacks have no RSS constraint tying ports to pools,
+       * so we are free to shard the pools to spread pool-list contention
+       * across destinations; the lookup side iterates all pools starting
+       * from the 4-tuple hash, so every port remains reachable. */
+      no_active_wild_pools = CI_MIN(NI_OPTS(ni).tcp_shared_local_ports_pools,
+                                    64u);
+      if( ! is_power_of_2(no_active_wild_pools) )
+        no_active_wild_pools = 1u << (__fls(no_active_wild_pools - 1) + 1);
+    }
     /* Max active wilds is bounded by the number of local IPs and
      * shared local ports. */
     no_active_wild_table_entries =
@@ -4668,6 +4678,7 @@ thr_reset_stack_tx_cb_state_init(struct thr_reset_stack_tx_cb_state* cb_state,
   cb_state->thr = thr;
   cb_state->ps.tx_pkt_free_list_insert = &cb_state->ps.tx_pkt_free_list;
   cb_state->ps.tx_pkt_free_list_n = 0;
+  cb_state->ps.rx_last_sock = NULL;
 }
 
 static void thr_reset_stack_tx_cb(ef_request_id id, void* arg)
@@ -6501,6 +6512,10 @@ efab_tcp_helper_more_bufs(tcp_helper_resource_t* trs)
   ni->packets->set[bufset_id].shm_id = -1;
 #endif
   ni->packets->set[bufset_id].dma_addr_base = ni->dma_addr_next;
+  /* Tag the set with the node its pages came from (oo_iobufset_pages_alloc
+   * allocates on the caller's node), so allocation can prefer node-local
+   * sets. */
+  ni->packets->set[bufset_id].numa_node = numa_node_id();
   if( page_order > CI_CFG_PKTS_PER_SET_S ) {
     /* page_order=INT_MAX means that there are no hardware interfaces associated
      * with this stack. */
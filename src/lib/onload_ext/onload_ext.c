@@ -152,6 +152,18 @@ int onload_zc_send(struct onload_zc_mmsg* msgs, int mlen, int flags)
   return -ENOSYS;
 }
 
+__attribute__((weak))
+int onload_zc_send_completions(int fd, void** app_cookies, int n)
+{
+  return -ENOSYS;
+}
+
+__attribute__((weak))
+int onload_zc_hlrx_buffer_release_n(int fd, onload_zc_handle* bufs, int n)
+{
+  return -ENOSYS;
+}
+
 /**************************************************************************/
 
 __attribute__((weak))
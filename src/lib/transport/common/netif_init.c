@@ -300,17 +300,27 @@ int citp_netif_get_process_stack(ci_netif** out_ni, const char* stackname)
                     CI_CFG_STACK_NAME_LEN) == 0 )
           if( strlen((*out_ni)->state->name) != 0 ||
               ((*out_ni)->flags & CI_NETIF_FLAGS_DONT_USE_ANON) == 0 )
-            return 0;
+            goto found;
       }
       else if( (*out_ni)->state->flags & CI_NETIF_FLAG_SCALABLE_FILTERS_RSS &&
                (*out_ni)->state->pid == getpid() ) {
         /* We pick the stack that is marked with the above flag.
          * A process is expected to have access only to one of these. */
-        return 0;
+        goto found;
      }
   }
 
   return -ENOENT;
+
+ found:
+  /* Move the match to the front of the list.  Threads creating sockets
+   * in bursts (per-thread stacknames in particular) then find their
+   * stack at the head instead of strncmp-walking every active netif. */
+  if( &(*out_ni)->link != ci_dllist_head(&citp_active_netifs) ) {
+    ci_dllist_remove(&(*out_ni)->link);
+    ci_dllist_push(&citp_active_netifs, &(*out_ni)->link);
+  }
+  return 0;
 }
 
 
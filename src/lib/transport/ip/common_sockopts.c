@@ -704,6 +704,13 @@ int ci_get_sol_socket( ci_netif* netif, ci_sock_cmn* s,
     goto u_out;
   }
 
+  case SO_MAX_PACING_RATE:
+    if( s->b.state == CI_TCP_STATE_UDP )
+      u = CI_MIN(SOCK_TO_UDP(s)->pace_rate, (ci_uint64) (unsigned) -1);
+    else
+      u = (unsigned) -1;
+    goto u_out;
+
 #ifdef SO_SELECT_ERR_QUEUE
   case SO_SELECT_ERR_QUEUE:
     if( s->s_aflags & CI_SOCK_AFLAG_SELECT_ERR_QUEUE )
@@ -1713,6 +1720,32 @@ int ci_set_sol_socket(ci_netif* netif, ci_sock_cmn* s,
     break;
   }
 
+  case SO_MAX_PACING_RATE:
+  {
+    /* Software token-bucket pacing; only implemented for UDP sockets.
+     * As on Linux, the value is a rate in bytes per second and ~0U
+     * disables pacing.
+     *
+     * NB. this diverges from Linux for TCP: the kernel paces TCP with
+     * this option, but Onload's TCP sends bypass the kernel and are not
+     * paced.  The option is accepted and ignored rather than failed so
+     * that applications which set it on all their sockets keep
+     * working. */
+    unsigned val;
+    if( (rc = opt_not_ok(optval, optlen, unsigned)) )
+      goto fail_inval;
+    val = *(unsigned*) optval;
+    if( s->b.state != CI_TCP_STATE_UDP )
+      break;
+    {
+      ci_udp_state* us = SOCK_TO_UDP(s);
+      us->pace_rate = (val == (unsigned) -1) ? 0 : val;
+      us->pace_tokens = 0;
+      ci_frc64(&us->pace_last_frc);
+    }
+    break;
+  }
+
 #if CI_CFG_TIMESTAMPING
   case ONLOAD_SO_TIMESTAMPING:
     if( (rc = opt_not_ok(optval, optlen, unsigned)) )
@@ -100,6 +100,35 @@ __ci_ip_copy_pkt_to_user(ci_netif* ni, ci_iovec* iov, ci_ip_pkt_fmt* pkt,
 }
 
 #else /* ifdef __KERNEL__ ... else */
+
+#ifdef __x86_64__
+#include <emmintrin.h>
+
+/* Copy payload into the application's buffer with non-temporal stores.
+ * For bulk transfers the application won't touch the payload until long
+ * after it has left the cache, so streaming it avoids evicting the
+ * stack's own hot state one packet at a time.
+ */
+static void copy_pkt_to_user_nt(void* dst, const void* src, size_t len)
+{
+  char* d = dst;
+  const char* s = src;
+
+  while( ((uintptr_t) d & 7) != 0 && len > 0 ) {
+    *d++ = *s++;
+    --len;
+  }
+  for( ; len >= 8; len -= 8, d += 8, s += 8 ) {
+    uint64_t w;
+    memcpy(&w, s, 8);
+    _mm_stream_si64((long long*) d, w);
+  }
+  _mm_sfence();
+  while( len-- > 0 )
+    *d++ = *s++;
+}
+#endif
+
 ssize_t
 __ci_ip_copy_pkt_to_user(ci_netif* ni, ci_iovec* iov,
                          ci_ip_pkt_fmt* pkt, int peek_off)
@@ -109,6 +138,13 @@ __ci_ip_copy_pkt_to_user(ci_netif* ni, ci_iovec* iov,
   len = oo_offbuf_left(&pkt->buf) - peek_off;
   len = CI_MIN(len, CI_IOVEC_LEN(iov));
 
+#ifdef __x86_64__
+  if( NI_OPTS(ni).tcp_recv_nt_thresh != 0 &&
+      len >= NI_OPTS(ni).tcp_recv_nt_thresh )
+    copy_pkt_to_user_nt(CI_IOVEC_BASE(iov),
+                        oo_offbuf_ptr(&pkt->buf) + peek_off, len);
+  else
+#endif
   memcpy(CI_IOVEC_BASE(iov), oo_offbuf_ptr(&pkt->buf) + peek_off, len);
 
   CI_IOVEC_BASE(iov) = (char *)CI_IOVEC_BASE(iov) + len;
@@ -348,17 +348,23 @@ void ip_cmsg_recv_timestamping(ci_netif *ni, const ci_ip_pkt_fmt *pkt,
     if( flags & ONLOAD_SOF_TIMESTAMPING_SOFTWARE && pkt->tstamp_frc != 0 )
       ci_udp_compute_stamp(ni, pkt->tstamp_frc, &ts.swtime);
 
-    struct onload_timestamp ots;
-    struct timespec nic;
-    ci_rx_pkt_timestamp_nic(pkt, &ots);
-    onload_timestamp_to_timespec(&ots, &nic);
-
-    if( flags & ONLOAD_SOF_TIMESTAMPING_SYS_HARDWARE &&
-        nic.tv_nsec & CI_IP_PKT_HW_STAMP_FLAG_IN_SYNC )
-      ts.hwtimesys = nic;
-
-    if( flags & ONLOAD_SOF_TIMESTAMPING_RAW_HARDWARE )
-      ts.hwtimeraw = nic;
+    /* Only extract and convert the NIC timestamp if a hardware stamp was
+     * actually requested; software-only sockets skip the whole
+     * conversion. */
+    if( flags & (ONLOAD_SOF_TIMESTAMPING_SYS_HARDWARE |
+                 ONLOAD_SOF_TIMESTAMPING_RAW_HARDWARE) ) {
+      struct onload_timestamp ots;
+      struct timespec nic;
+      ci_rx_pkt_timestamp_nic(pkt, &ots);
+      onload_timestamp_to_timespec(&ots, &nic);
+
+      if( flags & ONLOAD_SOF_TIMESTAMPING_SYS_HARDWARE &&
+          nic.tv_nsec & CI_IP_PKT_HW_STAMP_FLAG_IN_SYNC )
+        ts.hwtimesys = nic;
+
+      if( flags & ONLOAD_SOF_TIMESTAMPING_RAW_HARDWARE )
+        ts.hwtimeraw = nic;
+    }
 
     ci_put_cmsg(cmsg_state, SOL_SOCKET, ONLOAD_SO_TIMESTAMPING, sizeof(ts), &ts);
   }
@@ -217,6 +217,7 @@ static int ci_ip_timer_cascadewheel(ci_netif* netif, int wheelno,
   int changed = 0;
 
   ci_assert(wheelno > 0 && wheelno < CI_IPTIME_WHEELS);
+  CITP_STATS_NETIF_INC(netif, timer_cascades);
   /* check time is on the boundary expected by the wheel number passed in */
   ci_assert( (stime & ((unsigned)(-1) << (CI_IPTIME_BUCKETBITS*wheelno))) == stime );
 
@@ -269,6 +270,7 @@ static int ci_ip_timer_cascadewheel(ci_netif* netif, int wheelno,
     ** larger relative time. Oh well doesn't really matter
     */
     oo_p_dllink_add_tail(netif, bucket, oo_p_dllink_statep(netif, ts->statep));
+    CITP_STATS_NETIF_INC(netif, timer_cascade_moves);
 
     if( wheelno == 1 )
       __ci_timer_busy_set(netif, ts->time);
@@ -311,39 +313,48 @@ static void ci_ip_timer_docallback(ci_netif *netif, ci_ip_timer* ts)
   case CI_IP_TIMER_TCP_RTO:
     sp = oo_statep_to_sockp(netif, ts->statep);
     CHECK_TS(netif, SP_TO_TCP(netif, sp));
+    CITP_STATS_NETIF_INC(netif, timer_rto);
     ci_tcp_timeout_rto(netif, SP_TO_TCP(netif, sp));
     break;
   case CI_IP_TIMER_TCP_DELACK:
     sp = oo_statep_to_sockp(netif, ts->statep);
     CHECK_TS(netif, SP_TO_TCP(netif, sp));
+    CITP_STATS_NETIF_INC(netif, timer_delack);
     ci_tcp_timeout_delack(netif, SP_TO_TCP(netif, sp));
     break;
   case CI_IP_TIMER_TCP_ZWIN:
     sp = oo_statep_to_sockp(netif, ts->statep);
     CHECK_TS(netif, SP_TO_TCP(netif, sp));
+    CITP_STATS_NETIF_INC(netif, timer_zwin);
     ci_tcp_timeout_zwin(netif, SP_TO_TCP(netif, sp));
     break;
   case CI_IP_TIMER_TCP_KALIVE:
     sp = oo_statep_to_sockp(netif, ts->statep);
     CHECK_TS(netif, SP_TO_TCP(netif, sp));
+    CITP_STATS_NETIF_INC(netif, timer_kalive);
     ci_tcp_timeout_kalive(netif, SP_TO_TCP(netif, sp));
     break;
   case CI_IP_TIMER_TCP_LISTEN:
     sp = oo_statep_to_sockp(netif, ts->statep);
-    ci_tcp_timeout_listen(netif, SP_TO_TCP_LISTEN(netif, sp));    
+    CITP_STATS_NETIF_INC(netif, timer_listen);
+    ci_tcp_timeout_listen(netif, SP_TO_TCP_LISTEN(netif, sp));
     break;
   case CI_IP_TIMER_TCP_CORK:
     sp = oo_statep_to_sockp(netif, ts->statep);
+    CITP_STATS_NETIF_INC(netif, timer_cork);
     ci_tcp_timeout_cork(netif, SP_TO_TCP(netif, sp));
     break;
   case CI_IP_TIMER_NETIF_TCP_RECYCLE:
+    CITP_STATS_NETIF_INC(netif, timer_other);
     ci_ip_timer_do_recycle(netif);
     break;
   case CI_IP_TIMER_NETIF_TIMEOUT:
+    CITP_STATS_NETIF_INC(netif, timer_other);
     ci_netif_timeout_state(netif);
     break;
   case CI_IP_TIMER_PMTU_DISCOVER:
   {
+    CITP_STATS_NETIF_INC(netif, timer_other);
     oo_p pmtu_p = ts->statep;
     OO_P_ADD(pmtu_p, -CI_MEMBER_OFFSET(ci_ni_aux_mem, u.pmtus.tid));
     ci_pmtu_timeout_pmtu(netif, &ci_ni_aux_p2aux(netif, pmtu_p)->u.pmtus);
@@ -583,6 +583,8 @@ void ci_netif_dump_extra_to_logger(ci_netif* ni, oo_dump_log_fn_t logger,
   logger(log_arg, "  hwport_to_intf_i=%s intf_i_to_hwport=%s", hp2i, i2hp);
   logger(log_arg, "  uk_intf_ver=%s", OO_UK_INTF_VER);
   logger(log_arg, "  deferred count %d/%d", ns->defer_work_count, NI_OPTS(ni).defer_work_limit);
+  if( NI_OPTS(ni).adaptive_poll )
+    logger(log_arg, "  poll_budget=%u", ns->poll_budget);
   logger(log_arg, "  numa nodes: creation=%d load=%d",
          ns->creation_numa_node, ns->load_numa_node);
   logger(log_arg, "  numa node masks: packet alloc=%x sock alloc=%x interrupt=%x",
@@ -1384,10 +1384,23 @@ static void process_post_poll_list(ci_netif* ni)
   int i = 0;
 #endif
 
+  /* TX work done for the sockets on this list (tx_advance, ACKs) shares
+   * one doorbell per interface: bursts touching many sockets ring once
+   * instead of once per socket.  This function can recurse via loopback
+   * delivery's nested poll, so only the outermost invocation owns the
+   * batch. */
+  int defer_started = 0;
+  if( ! ni->state->tx_push_defer_on ) {
+    ci_netif_tx_push_defer_start(ni);
+    defer_started = 1;
+  }
+
   oo_p_dllink_for_each_safe(ni, lnk, tmp_lnk, post_poll_list) {
 #ifdef __KERNEL__
     if(CI_UNLIKELY( i++ > ni->ep_tbl_n )) {
       ci_netif_error_detected(ni, CI_NETIF_ERROR_POST_POLL_LIST, __FUNCTION__);
+      if( defer_started )
+        ci_netif_tx_push_defer_flush(ni);
       return;
     }
 #endif
@@ -1445,6 +1458,9 @@ static void process_post_poll_list(ci_netif* ni)
     oo_p_dllink_del_init(ni, lnk);
   }
 
+  if( defer_started )
+    ci_netif_tx_push_defer_flush(ni);
+
   CHECK_NI(ni);
 
 #if CI_CFG_EPOLL3
@@ -1694,6 +1710,45 @@ static ci_ip_pkt_fmt* alloc_rx_efct_pkt(ci_netif* ni, int intf_i, int pay_len)
   ++ni->state->n_rx_pkts;
   return pkt;
 }
+/* Per-poll event budget.  With EF_ADAPTIVE_POLL the budget floats between
+ * a quarter of and four times EF_EVS_PER_POLL, steered by
+ * ci_netif_poll_budget_update(); otherwise it is simply EF_EVS_PER_POLL.
+ */
+ci_inline unsigned ci_netif_poll_budget(ci_netif* ni)
+{
+  return NI_OPTS(ni).adaptive_poll ? ni->state->poll_budget :
+         NI_OPTS(ni).evs_per_poll;
+}
+
+
+static void ci_netif_poll_budget_update(ci_netif* ni, int intf_i,
+                                        int total_evs)
+{
+  unsigned budget = ni->state->poll_budget;
+
+  if( ! NI_OPTS(ni).adaptive_poll )
+    return;
+
+  if( ni->state->n_spinners > 0 ) {
+    /* Latency-sensitive threads are spinning: keep batches small so they
+     * get back to their sockets quickly. */
+    unsigned min_budget = CI_MAX(NI_OPTS(ni).evs_per_poll / 4, 16u);
+    if( budget > min_budget ) {
+      ni->state->poll_budget = CI_MAX(budget / 2, min_budget);
+      CITP_STATS_NETIF_INC(ni, adaptive_poll_shrink);
+    }
+  }
+  else if( (unsigned) total_evs >= budget &&
+           ci_netif_intf_has_event(ni, intf_i) ) {
+    /* We used the whole budget and the queue is still deep: batch
+     * harder. */
+    unsigned max_budget = CI_MIN(NI_OPTS(ni).evs_per_poll, 0x1fffffffu) * 4;
+    if( budget < max_budget ) {
+      ni->state->poll_budget = CI_MIN(budget * 2, max_budget);
+      CITP_STATS_NETIF_INC(ni, adaptive_poll_grow);
+    }
+  }
+}
 
 
 static int ci_netif_poll_evq(ci_netif* ni, struct ci_netif_poll_state* ps,
@@ -1942,7 +1997,9 @@ have_events:
     __handle_rx_pkt(ni, ps, &s.rx_pkt);
 
     total_evs += n_evs;
-  } while( total_evs < NI_OPTS(ni).evs_per_poll );
+  } while( total_evs < (int) ci_netif_poll_budget(ni) );
+
+  ci_netif_poll_budget_update(ni, intf_i, total_evs);
 
   /* If we've drained the TXQ, we can start trying CTPIO again. */
   if( completed_tx &&
@@ -1972,6 +2029,7 @@ static int ci_netif_poll_intf(ci_netif* ni, int intf_i, int max_evs)
   ci_assert(ci_netif_is_locked(ni));
   ps.tx_pkt_free_list_insert = &ps.tx_pkt_free_list;
   ps.tx_pkt_free_list_n = 0;
+  ps.rx_last_sock = NULL;
 
   do {
     rc = ci_netif_poll_evq(ni, &ps, intf_i, 0);
@@ -2045,6 +2103,7 @@ int ci_netif_poll_intf_future(ci_netif* ni, int intf_i, ci_uint64 start_frc)
 
   ps.tx_pkt_free_list_insert = &ps.tx_pkt_free_list;
   ps.tx_pkt_free_list_n = 0;
+  ps.rx_last_sock = NULL;
 
   /* We expect the completion event within a microsecond or so. The timeout
    * of 100us is to avoid wedging the stack in the case of hardware
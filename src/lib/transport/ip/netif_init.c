@@ -83,6 +83,9 @@ void ci_netif_state_init(ci_netif* ni, int cpu_khz, const char* name)
   assert_zero(nis->mem_pressure_pkt_pool_n);
   nis->looppkts = OO_PP_NULL;
   nis->n_looppkts = 0;
+  nis->poll_budget = NI_OPTS(ni).evs_per_poll;
+  assert_zero(nis->tx_push_defer_on);
+  assert_zero(nis->tx_push_deferred_intfs);
 
   /* Pool of packet buffers for transmit. */
   assert_zero(nis->n_async_pkts);
@@ -15,6 +15,7 @@
 #if !defined(__KERNEL__)
 #include <onload/mmap.h>
 #include <sys/shm.h>
+#include <sys/syscall.h>
 
 pthread_mutex_t citp_pkt_map_lock = PTHREAD_MUTEX_INITIALIZER;
 
@@ -86,22 +87,55 @@ ci_ip_pkt_fmt* __ci_netif_pkt(ci_netif* ni, unsigned id)
 #endif
 
 
+/* The NUMA node this thread is currently running on, or -1 if unknown.
+ * Only used on the packet-set selection slow path, so an occasional
+ * syscall is acceptable. */
+ci_inline int ci_current_numa_node(void)
+{
+#ifdef __KERNEL__
+  return numa_node_id();
+#elif defined(SYS_getcpu)
+  unsigned node;
+  if( syscall(SYS_getcpu, NULL, &node, NULL) == 0 )
+    return node;
+  return -1;
+#else
+  return -1;
+#endif
+}
+
+
 int ci_netif_pktset_best(ci_netif* ni)
 {
   int i, ret = -1, n_free = 0;
-  
+  int local_ret = -1, local_n_free = 0;
+  int node = ci_current_numa_node();
+
   for( i = 0; i < ni->packets->sets_n; i ++ ) {
     if( ni->packets->set[i].n_free > n_free ) {
       n_free = ni->packets->set[i].n_free;
       ret = i;
     }
-    if( n_free >= CI_CFG_PKT_SET_HIGH_WATER ) {
+    if( node >= 0 && ni->packets->set[i].numa_node == node &&
+        ni->packets->set[i].n_free > local_n_free ) {
+      local_n_free = ni->packets->set[i].n_free;
+      local_ret = i;
+    }
+    /* A node-local set that is almost-free is the ideal answer. */
+    if( local_n_free >= CI_CFG_PKT_SET_HIGH_WATER )
+      return local_ret;
+    if( n_free >= CI_CFG_PKT_SET_HIGH_WATER && node < 0 ) {
       /* We've found a set which is almost-free.  Let's reuse it
        * to avoid pulling in any new sets, and keep all the used packets
        * in a small group of working sets. */
       return ret;
     }
   }
+  /* Prefer a node-local set with a reasonable amount free over a fuller
+   * remote set: remote packet touches cost more than a slightly less
+   * efficient working set. */
+  if( local_ret != -1 && local_n_free >= n_free / 2 )
+    return local_ret;
   return ret;
 }
 
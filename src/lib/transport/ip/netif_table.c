@@ -308,6 +308,10 @@ ci_netif_filter_for_each_match(ci_netif* ni,
     }
     entry = &tbl->table[hash1];
     entry_ext = &ni->filter_table_ext[hash1];
+    /* Each double-hashing step lands on an unrelated cacheline, so at
+     * high occupancy long probe chains pay a miss per step.  Start the
+     * next step's line loading while we examine this entry. */
+    ci_prefetch(&tbl->table[(hash1 + hash2) & table_size_mask]);
     if( OCCUPIED(entry) ) {
       if( handle_entry(ni, entry, entry_ext, laddr, lport, raddr, rport,
                        protocol, intf_i, vlan, callback, callback_arg,
@@ -1,5 +1,8 @@
 /* SPDX-License-Identifier: GPL-2.0 */
 /* X-SPDX-Copyright-Text: (c) Copyright 2018-2020 Xilinx, Inc. */
+
+/* Building with CI_CFG_IPV6 disabled compiles this file and the ipx
+ * generality down to the IPv4-only forms; the dispatch is compile-time. */
 #include <ci/internal/transport_config_opt.h>
 #include "ip_internal.h"
 #include <onload/hash.h>
@@ -184,6 +187,9 @@ ci_netif_filter_for_each_match_ip6(ci_netif* ni,
                     IPX_ARG(AF_IP(raddr)), rport, hash1, hash2));
       break;
     }
+    /* As in the IPv4 table: each probe step lands on an unrelated
+     * cacheline, so load the next step's line while examining this one. */
+    ci_prefetch(&tbl->table[(hash1 + hash2) & table_size_mask]);
   }
   return 0;
 }
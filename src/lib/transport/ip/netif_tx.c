@@ -194,6 +194,14 @@ static void __ci_netif_dmaq_shove(ci_netif* ni, oo_pktq* dmaq, ef_vi* vi,
   ci_netif_ctpio_desist(ni, intf_i);
 #endif
 
+  if( ni->state->tx_push_defer_on && vi == ci_netif_vi(ni, intf_i) ) {
+    /* Part of a deferred-doorbell batch: record the interface and let
+     * ci_netif_tx_push_defer_flush() ring once for everyone. */
+    ci_wmb();
+    ni->state->tx_push_deferred_intfs |= 1u << intf_i;
+    return;
+  }
+
   ef_vi_transmit_push(vi);
   CITP_STATS_NETIF_INC(ni, tx_dma_doorbells);
 }
@@ -226,6 +234,27 @@ void ci_netif_dmaq_shove_plugin(ci_netif* ni, int intf_i, int q_id)
 }
 
 
+void ci_netif_tx_push_defer_flush(ci_netif* ni)
+{
+  int intf_i;
+
+  ci_assert(ci_netif_is_locked(ni));
+  ni->state->tx_push_defer_on = 0;
+  while( ni->state->tx_push_deferred_intfs != 0 ) {
+    ef_vi* vi;
+    intf_i = ci_ffs64(ni->state->tx_push_deferred_intfs) - 1;
+    ni->state->tx_push_deferred_intfs &= ~(1u << intf_i);
+    vi = ci_netif_vi(ni, intf_i);
+    /* A poll during the batch (eg. from __ci_netif_send()) may already
+     * have pushed our descriptors along with its own. */
+    if( vi->ep_state->txq.previous != vi->ep_state->txq.added ) {
+      ef_vi_transmit_push(vi);
+      CITP_STATS_NETIF_INC(ni, tx_dma_doorbells);
+    }
+  }
+}
+
+
 void __ci_netif_send(ci_netif* netif, ci_ip_pkt_fmt* pkt)
 {
   int intf_i, rc;
@@ -273,6 +302,12 @@ void __ci_netif_send(ci_netif* netif, ci_ip_pkt_fmt* pkt)
   vi = &netif->nic_hw[intf_i].vis[pkt_q_id(pkt)];
 
   if( oo_pktq_is_empty(dmaq) && ! (pkt->flags & CI_PKT_FLAG_INDIRECT) ) {
+    /* In deferred-push mode only the plain DMA doorbell is deferred;
+     * PIO and CTPIO manage their own pushes (and any push they issue
+     * also covers our deferred descriptors, which the flush tolerates).
+     */
+    int defer_push = netif->state->tx_push_defer_on &&
+                     pkt_q_id(pkt) == CI_Q_ID_NORMAL;
 #if CI_CFG_PIO
     /* pio_thresh is set to zero if PIO disabled on this stack, so don't
      * need to check NI_OPTS().pio here
@@ -332,7 +367,15 @@ void __ci_netif_send(ci_netif* netif, ci_ip_pkt_fmt* pkt)
     }
     else
 #endif
-    if( (rc = ef_vi_transmitv(vi, iov, iov_len, OO_PKT_ID(pkt))) == 0 ) {
+    if( defer_push ) {
+      if( (rc = ef_vi_transmitv_init(vi, iov, iov_len, OO_PKT_ID(pkt)))
+          == 0 ) {
+        ci_wmb();
+        netif->state->tx_push_deferred_intfs |= 1u << intf_i;
+        ci_netif_ctpio_desist(netif, intf_i);
+      }
+    }
+    else if( (rc = ef_vi_transmitv(vi, iov, iov_len, OO_PKT_ID(pkt))) == 0 ) {
       /* After a DMA send, stop attempting CTPIO sends until the TXQ has
        * drained. */
       ci_netif_ctpio_desist(netif, intf_i);
@@ -87,6 +87,29 @@ ci_pio_buddy_free_list_pop(ci_netif* ni, ci_pio_buddy_allocator* b,
 }
 
 
+/* Free a block straight into the buddy lists, merging with its buddy
+ * where possible.  Common code for ci_pio_buddy_free() and draining the
+ * per-order free caches. */
+static void
+ci_pio_buddy_free_to_lists(ci_netif* ni, ci_pio_buddy_allocator* b,
+                           ci_uint32 addr, ci_uint8 order);
+
+
+/* Drain all per-order free caches into the buddy lists so that blocks can
+ * merge.  Called when an allocation fails to find space. */
+static void
+ci_pio_buddy_cache_drain(ci_netif* ni, ci_pio_buddy_allocator* b)
+{
+  ci_uint8 o;
+
+  for( o = 0; o <= CI_PIO_BUDDY_MAX_ORDER; ++o ) {
+    while( b->free_cache_n[o] > 0 )
+      ci_pio_buddy_free_to_lists(ni, b,
+                                 b->free_cache[o][--b->free_cache_n[o]], o);
+  }
+}
+
+
 void
 ci_pio_buddy_ctor(ci_netif* ni, ci_pio_buddy_allocator* b, unsigned pio_len)
 {
@@ -116,6 +139,9 @@ ci_pio_buddy_ctor(ci_netif* ni, ci_pio_buddy_allocator* b, unsigned pio_len)
   /* At initialisation we have one free block containing the whole space. */
   ci_pio_buddy_free_list_add(ni, b, pio_order - CI_CFG_MIN_PIO_BLOCK_ORDER, 0);
 
+  for( o = 0; o <= CI_PIO_BUDDY_MAX_ORDER; ++o )
+    b->free_cache_n[o] = 0;
+
   b->initialised = 1;
 }
 
@@ -136,12 +162,29 @@ ci_pio_buddy_alloc(ci_netif* ni, ci_pio_buddy_allocator* b, ci_uint8 order)
   if( b->initialised ) {
     order -= CI_CFG_MIN_PIO_BLOCK_ORDER;
 
+    /* Fast path: reuse a recently freed block of the same order. */
+    if( b->free_cache_n[order] > 0 ) {
+      addr = b->free_cache[order][--b->free_cache_n[order]];
+      ci_assert_equal(b->orders[addr], order);
+      return addr * (1u << CI_CFG_MIN_PIO_BLOCK_ORDER);
+    }
+
     /* Find smallest free block that is big enough. */
     smallest = order;
     while( smallest <= CI_PIO_BUDDY_MAX_ORDER &&
            ci_pio_buddy_free_list_empty(ni, b, smallest) )
       ++smallest;
 
+    if( smallest > CI_PIO_BUDDY_MAX_ORDER ) {
+      /* Cached blocks can't merge; return them to the lists and see if
+       * that frees up a big enough block. */
+      ci_pio_buddy_cache_drain(ni, b);
+      smallest = order;
+      while( smallest <= CI_PIO_BUDDY_MAX_ORDER &&
+             ci_pio_buddy_free_list_empty(ni, b, smallest) )
+        ++smallest;
+    }
+
     if( smallest > CI_PIO_BUDDY_MAX_ORDER ) {
       DEBUG_ALLOC(ci_log("buddy - alloc order %d failed - max order %d",
                          order, CI_PIO_BUDDY_MAX_ORDER););
@@ -173,21 +216,11 @@ ci_pio_buddy_alloc(ci_netif* ni, ci_pio_buddy_allocator* b, ci_uint8 order)
 }
 
 
-void
-ci_pio_buddy_free(ci_netif* ni, ci_pio_buddy_allocator* b, ci_int32 offset,
-                  ci_uint8 order)
+static void
+ci_pio_buddy_free_to_lists(ci_netif* ni, ci_pio_buddy_allocator* b,
+                           ci_uint32 addr, ci_uint8 order)
 {
   ci_uint32 buddy_addr;
-  ci_uint32 addr = offset / (1u << CI_CFG_MIN_PIO_BLOCK_ORDER);
-  order -= CI_CFG_MIN_PIO_BLOCK_ORDER;
-
-  /* Order should be within valid range and addr should be for a valid block */
-  ci_assert_le(order, CI_PIO_BUDDY_MAX_ORDER);
-  ci_assert_le(addr + (1u << order), 1u << CI_PIO_BUDDY_MAX_ORDER);
-  /* Check we're freeing something that's been allocated. */
-  ci_assert(!ci_pio_buddy_addr_in_free_list(ni, b, addr));
-  /* Check what we're freeing has the size we expect. */
-  ci_assert_equal(b->orders[addr], order);
 
   /* If this block isn't of the maximum order then freeing it may allow us
    * to merge it with its buddy.
@@ -223,4 +256,30 @@ ci_pio_buddy_free(ci_netif* ni, ci_pio_buddy_allocator* b, ci_int32 offset,
 }
 
 
+void
+ci_pio_buddy_free(ci_netif* ni, ci_pio_buddy_allocator* b, ci_int32 offset,
+                  ci_uint8 order)
+{
+  ci_uint32 addr = offset / (1u << CI_CFG_MIN_PIO_BLOCK_ORDER);
+  order -= CI_CFG_MIN_PIO_BLOCK_ORDER;
+
+  /* Order should be within valid range and addr should be for a valid block */
+  ci_assert_le(order, CI_PIO_BUDDY_MAX_ORDER);
+  ci_assert_le(addr + (1u << order), 1u << CI_PIO_BUDDY_MAX_ORDER);
+  /* Check we're freeing something that's been allocated. */
+  ci_assert(!ci_pio_buddy_addr_in_free_list(ni, b, addr));
+  /* Check what we're freeing has the size we expect. */
+  ci_assert_equal(b->orders[addr], order);
+
+  /* Cache the block for O(1) reuse at the same order; merging is deferred
+   * until an allocation actually needs a larger block. */
+  if( b->free_cache_n[order] < CI_PIO_BUDDY_CACHE_SIZE ) {
+    b->free_cache[order][b->free_cache_n[order]++] = addr;
+    return;
+  }
+
+  ci_pio_buddy_free_to_lists(ni, b, addr, order);
+}
+
+
 /*! \cidoxg_end */
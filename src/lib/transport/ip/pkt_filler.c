@@ -77,6 +77,24 @@ int oo_pkt_fill(ci_netif* ni, ci_sock_cmn* s, int* p_netif_locked,
   ci_assert(pf->buf_end <= CI_PTR_ALIGN_FWD(PKT_START(pf->last_pkt),
                                             CI_CFG_PKT_BUF_SIZE));
 
+  /* Fast path: the whole fill is a single copy from the current iovec
+   * into the current buffer.  For small datagrams -- the overwhelming
+   * majority at high message rates -- this skips the per-fragment loop
+   * entirely.
+   */
+  if(CI_LIKELY( bytes_to_copy <= (int) (pf->buf_end - pf->buf_start) &&
+                (size_t) bytes_to_copy <= CI_IOVEC_LEN(&piov->io) )) {
+    if(CI_UNLIKELY( oo_pkt_fill_copy(pf->buf_start, CI_IOVEC_BASE(&piov->io),
+                                     bytes_to_copy
+                                     CI_KERNEL_ARG(addr_spc)) != 0 ))
+      return -EFAULT;
+    pf->buf_start += bytes_to_copy;
+    pf->pkt->pay_len += bytes_to_copy;
+    ci_iovec_ptr_advance(piov, bytes_to_copy);
+    pf->last_pkt->buf_len = pf->buf_start - PKT_START(pf->last_pkt);
+    return 0;
+  }
+
   while( 1 ) {
     n = (int) (pf->buf_end - pf->buf_start);
     n = CI_MIN((size_t)n, CI_IOVEC_LEN(&piov->io));
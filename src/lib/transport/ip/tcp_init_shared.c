@@ -153,6 +153,8 @@ void ci_tcp_state_tcb_reinit_minimal(ci_netif* netif, ci_tcp_state* ts)
   ts->sv = NI_CONF(netif).tconst_rto_initial; /* cwndrecover b4 rtt measured */
 
   ts->local_peer = OO_SP_NULL;
+
+  ts->rtq_sack_hint = OO_PP_NULL;
 }
 
 /* Reset state for a connection, used for shutdown following listen. */
@@ -906,6 +906,7 @@ void ci_tcp_clear_sacks(ci_netif* ni, ci_tcp_state* ts)
 
   ts->retrans_seq = tcp_snd_una(ts);
   ts->retrans_ptr = rtq->head;
+  ts->rtq_sack_hint = OO_PP_NULL;
 }
 
 
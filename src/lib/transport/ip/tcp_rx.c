@@ -1066,8 +1066,23 @@ ci_tcp_rx_sack_process_block(ci_netif* ni, ci_tcp_state* ts, unsigned start,
 
   /* Find the block the first packet covered is in.  (The packet at the
   ** head of rtq certainly won't qualify).
+  **
+  ** Consecutive ACKs during recovery mostly carry SACK blocks at or
+  ** beyond the last one processed, so resume the walk from the start of
+  ** the most recently SACKed block where we can, rather than from the
+  ** head of a possibly very long retransmit queue.  The hint is dropped
+  ** whenever the queue is restructured, and is additionally validated
+  ** against the recorded sequence number here.
   */
   next_pp = rtq->head;
+  if( OO_PP_NOT_NULL(ts->rtq_sack_hint) ) {
+    ci_ip_pkt_fmt* hint = PKT_CHK(ni, ts->rtq_sack_hint);
+    if( (hint->flags & CI_PKT_FLAG_RTQ_SACKED) &&
+        SEQ_EQ(hint->pf.tcp_tx.start_seq, ts->rtq_sack_hint_seq) &&
+        SEQ_LT(tcp_snd_una(ts), ts->rtq_sack_hint_seq) &&
+        SEQ_LE(ts->rtq_sack_hint_seq, start) )
+      next_pp = ts->rtq_sack_hint;
+  }
   while( 1 ) {
     start_block = PKT_CHK(ni, next_pp);
     if( OO_PP_IS_NULL(start_block->pf.tcp_tx.block_end) ) {
@@ -1202,6 +1217,12 @@ ci_tcp_rx_sack_process_block(ci_netif* ni, ci_tcp_state* ts, unsigned start,
     pkt = start_block;
   else
     pkt = start_pkt;
+
+  /* [pkt] is the start of the block this SACK lands in: remember it so
+   * the next walk can start here. */
+  ts->rtq_sack_hint = OO_PKT_P(pkt);
+  ts->rtq_sack_hint_seq = pkt->pf.tcp_tx.start_seq;
+
   while( pkt != end_pkt ) {
     pkt->pf.tcp_tx.block_end = next_pp;
     pkt->flags |= CI_PKT_FLAG_RTQ_SACKED;
@@ -1402,6 +1423,9 @@ static void ci_tcp_rx_free_acked_bufs(ci_netif* netif, ci_tcp_state* ts,
 
     ci_ip_queue_dequeue(netif, rtq, p);
 
+    if( OO_PP_EQ(ts->rtq_sack_hint, OO_PKT_P(p)) )
+      ts->rtq_sack_hint = OO_PP_NULL;
+
     ci_assert(p->refcount > 0);
 
 #if CI_CFG_TIMESTAMPING
@@ -4350,7 +4374,10 @@ static void handle_rx_slow(ci_tcp_state* ts, ci_netif* netif,
       ** can't be interpreted as a dupack.
       */
       pkt = ci_netif_pkt_alloc(netif, 0);
-      if( pkt )  ci_tcp_send_ack_rx(netif, ts, pkt, CI_FALSE, do_update_wnd);
+      if( pkt ) {
+        CITP_STATS_NETIF_INC(netif, acks_forced);
+        ci_tcp_send_ack_rx(netif, ts, pkt, CI_FALSE, do_update_wnd);
+      }
     }
 
     /* May need to advance TX or send ACK. */
@@ -4599,6 +4626,11 @@ int ci_tcp_rx_deliver_to_conn(ci_sock_cmn* s, void* opaque_arg)
 
   CHECK_TS(ni, ts);
 
+  /* Remember this flow so that further segments for it in the same poll
+   * batch can skip the filter-table lookup. */
+  if( rxp->poll_state != NULL )
+    rxp->poll_state->rx_last_sock = s;
+
   ci_assert(CI_IPX_ADDR_EQ(RX_PKT_DADDR(pkt),
                              ipcache_laddr(&s->pkt)));
 #ifndef NDEBUG
@@ -4912,6 +4944,29 @@ void ci_tcp_handle_rx(ci_netif* netif, struct ci_netif_poll_state* ps,
   }
 #endif
 
+  /* Coalescing fast demux: a burst usually contains runs of segments for
+   * the same flow, so first try the socket that took the previous segment
+   * in this poll.  The checks mirror those of a filter-table hit (4-tuple
+   * against the socket), so a cache hit delivers exactly as the lookup
+   * below would.  Sockets bound to a device take the full lookup, which
+   * also performs the interface check.
+   */
+  if( ps != NULL && ps->rx_last_sock != NULL ) {
+    ci_sock_cmn* s = ps->rx_last_sock;
+    if( (s->b.state & CI_TCP_STATE_TCP_CONN) &&
+        sock_lport_be16(s) == tcp->tcp_dest_be16 &&
+        sock_rport_be16(s) == tcp->tcp_source_be16 &&
+        CI_IPX_ADDR_EQ(sock_ipx_laddr(s), daddr) &&
+        CI_IPX_ADDR_EQ(sock_ipx_raddr(s), saddr) &&
+        s->rx_bind2dev_ifindex == CI_IFID_BAD ) {
+      rxp.hash = ci_netif_filter_hash(netif, daddr, tcp->tcp_dest_be16,
+                                      saddr, tcp->tcp_source_be16,
+                                      IPPROTO_TCP);
+      ci_tcp_rx_deliver_to_conn(s, &rxp);
+      return;
+    }
+  }
+
 #if CI_CFG_IPV6
   if( oo_pkt_af(pkt) == AF_INET6 ) {
     ci_netif_filter_for_each_match_ip6(netif,
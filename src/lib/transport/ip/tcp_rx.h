@@ -88,6 +88,7 @@ ci_inline void ci_tcp_rx_post_poll(ci_netif* ni, ci_tcp_state* ts)
     if( ci_tcp_need_ack(ni, ts) ) {
       ci_ip_pkt_fmt* pkt = ci_netif_pkt_alloc(ni, 0);
       if(CI_LIKELY( pkt != NULL )) {
+        CITP_STATS_NETIF_INC(ni, acks_sent_post_poll);
         ci_tcp_send_ack(ni, ts, pkt, CI_FALSE);
         return;
       }
@@ -758,6 +758,30 @@ int ci_tcp_tmpl_alloc(ci_netif* ni, ci_tcp_state* ts,
   pkt->pio_order = ci_log2_ge(ts->outgoing_hdrs_len + ETH_HLEN + ETH_VLAN_HLEN
                               + total_unsent, CI_CFG_MIN_PIO_BLOCK_ORDER);
   pkt->pio_addr = ci_pio_buddy_alloc(ni, &nsn->pio_buddy, pkt->pio_order);
+  if( pkt->pio_addr < 0 ) {
+    /* PIO region exhausted: spill the oldest of this socket's templates
+     * that holds a big enough block on this interface and retry.  The
+     * victim keeps working through the DMA slow path and re-acquires
+     * PIO lazily at its next update, exactly as a template allocated
+     * with ONLOAD_TEMPLATE_FLAGS_PIO_RETRY does.
+     */
+    ci_ip_pkt_fmt* victim = NULL;
+    oo_pkt_p pp2;
+    for( pp2 = ts->tmpl_head; OO_PP_NOT_NULL(pp2); ) {
+      ci_ip_pkt_fmt* t = PKT_CHK(ni, pp2);
+      if( t->pio_addr >= 0 && t->intf_i == intf_i &&
+          t->pio_order >= pkt->pio_order )
+        victim = t;
+      pp2 = t->next;
+    }
+    if( victim != NULL ) {
+      ci_pio_buddy_free(ni, &nsn->pio_buddy, victim->pio_addr,
+                        victim->pio_order);
+      victim->pio_addr = -1;
+      pkt->pio_addr = ci_pio_buddy_alloc(ni, &nsn->pio_buddy,
+                                         pkt->pio_order);
+    }
+  }
   if( pkt->pio_addr < 0 ) {
     pkt->pio_addr = -1;
     if( ! (flags & ONLOAD_TEMPLATE_FLAGS_PIO_RETRY) ) {
@@ -1853,8 +1877,8 @@ ci_tcp_send_alloc_pkts(ci_netif* ni, ci_tcp_state* ts,
   ci_assert_gt(sinf->total_unsent, 0);
   ci_assert_gt(sinf->sendq_credit, 0);
 
-  sinf->n_needed = ci_tcp_tx_n_pkts_needed(ts->eff_mss, sinf->total_unsent, 
-                                          CI_CFG_TCP_TX_BATCH,
+  sinf->n_needed = ci_tcp_tx_n_pkts_needed(ts->eff_mss, sinf->total_unsent,
+                                          NI_OPTS(ni).tcp_tx_fill_batch,
                                           sinf->sendq_credit);
   rc = sinf->n_needed;
   sinf->fill_list = 0;
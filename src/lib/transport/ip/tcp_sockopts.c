@@ -60,6 +60,12 @@ static const struct ci_offload_type tcp_offloads[] = {
 #endif
 
 
+/* Note that this runs entirely at user level against the shared socket
+ * state: getsockopt(TCP_INFO) on an accelerated socket is a read-only
+ * shared-memory snapshot -- no syscall, no stack lock.  The fields are
+ * sampled individually rather than under a seqlock; for monitoring
+ * counters a torn read across fields is indistinguishable from sampling
+ * a moment earlier or later. */
 static int
 ci_tcp_info_get(ci_netif* netif, ci_sock_cmn* s, struct ci_tcp_info* uinfo,
                 socklen_t* optlen)
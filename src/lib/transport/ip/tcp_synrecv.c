@@ -988,6 +988,8 @@ int ci_tcp_listenq_try_promote(ci_netif* netif, ci_tcp_socket_listen* tls,
 #endif
 
     ci_bit_set(&ts->s.b.sb_aflags, CI_SB_AFLAG_TCP_IN_ACCEPTQ_BIT);
+    /* ci_tcp_acceptq_put() is a lock-free CAS push; accept() drains it
+     * into its ordered get-list under the listener's own lock. */
     ci_tcp_acceptq_put(netif, tls, &ts->s.b);
 
     LOG_TC(log(LNT_FMT "new ts=%d SYN-RECV->ESTABLISHED flags=0x%x",
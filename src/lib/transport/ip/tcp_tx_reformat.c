@@ -590,6 +590,10 @@ void ci_tcp_retrans_coalesce_block(ci_netif* ni, ci_tcp_state* ts,
   ci_ip_pkt_fmt* start;
   oo_pkt_p next_id;
 
+  /* Coalescing frees packets within the block, so the SACK walk hint may
+   * no longer point at a live block start. */
+  ts->rtq_sack_hint = OO_PP_NULL;
+
   if( OO_PP_EQ(pkt->pf.tcp_tx.block_end, OO_PKT_P(pkt)) )  return;
 
   start = pkt;
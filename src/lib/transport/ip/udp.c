@@ -86,6 +86,9 @@ static void ci_udp_state_init(ci_netif* netif, ci_udp_state* us)
   us->tx_async_q = CI_ILL_END;
   oo_atomic_set(&us->tx_async_q_level, 0);
   us->tx_count = 0;
+  us->pace_rate = 0;
+  us->pace_tokens = 0;
+  us->pace_last_frc = 0;
   us->udpflags = CI_UDPF_MCAST_LOOP;
   us->future_intf_i = 0;
   us->ip_pktinfo_cache.intf_i = -1;
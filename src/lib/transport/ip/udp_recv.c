@@ -1069,7 +1069,11 @@ int ci_udp_recvmmsg(ci_udp_iomsg_args *a, struct mmsghdr* mmsg,
 
     ++i;
 
-    if( timeout_msec >= 0 ) {
+    /* The timeout bounds how long we wait for messages, so the clock
+     * only needs reading when the next iteration might block; datagrams
+     * already queued are delivered without paying for gettimeofday()
+     * per message. */
+    if( timeout_msec >= 0 && ci_udp_recv_q_is_empty(&us->recv_q) ) {
       struct timeval tv_after, tv_sub;
       gettimeofday(&tv_after, NULL);
       /* Ignore any time where time seems to have gone backwards */
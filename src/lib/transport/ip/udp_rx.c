@@ -177,6 +177,7 @@ int ci_udp_rx_deliver(ci_sock_cmn* s, void* opaque_arg)
       q_pkt->n_buffers = pkt->n_buffers + 1;
       ci_netif_pkt_hold(ni, pkt);
       pkt = q_pkt;
+      CITP_STATS_NETIF_INC(ni, udp_rx_fanout_indirect);
     }
     ci_assert_nflags(pkt->rx_flags, CI_PKT_RX_FLAG_KEEP);
     ci_udp_recv_q_put(ni, &us->recv_q, pkt);
@@ -774,14 +774,24 @@ static void ci_udp_sendmsg_send(ci_netif* ni, ci_udp_state* us,
   /* Linux allows sending IPv6 packets with zero Hop Limit field */
   if( ipcache_ttl(ipcache) || ipcache_is_ipv6(ipcache) ) {
     if(CI_LIKELY( ipcache_onloadable )) {
-      /* TODO: Hit the doorbell just once. */
+      /* Fragments of one datagram share a single doorbell.  We may
+       * already be inside a batch (eg. draining the async queue), in
+       * which case that batch's flush covers us. */
+      int defer_started = 0;
+      if( OO_PP_NOT_NULL(pkt->next) && ! ni->state->tx_push_defer_on ) {
+        ci_netif_tx_push_defer_start(ni);
+        defer_started = 1;
+      }
       while( 1 ) {
         oo_pkt_p next = pkt->next;
         prep_send_pkt(ni, us, pkt, ipcache);
         /* We've called ci_netif_pkt_hold() in ci_udp_sendmsg_fill(). */
         ci_netif_send(ni, pkt);
-        if( OO_PP_IS_NULL(next) )
+        if( OO_PP_IS_NULL(next) ) {
+          if( defer_started )
+            ci_netif_tx_push_defer_flush(ni);
           break;
+        }
         pkt = PKT_CHK(ni, next);
 #ifdef __KERNEL__
         if(CI_UNLIKELY( i++ > ni->pkt_sets_n << CI_CFG_PKTS_PER_SET_S )) {
@@ -914,7 +924,8 @@ void ci_udp_sendmsg_send_async_q(ci_netif* ni, ci_udp_state* us)
 
   oo_atomic_add(&us->tx_async_q_level, -level);
 
-  /* Send each datagram. */
+  /* Send each datagram, sharing one doorbell across the batch. */
+  ci_netif_tx_push_defer_start(ni);
   while( 1 ) {
     pp = pkt->netif.tx.dmaq_next;
     if( pkt->flags & CI_PKT_FLAG_MSG_CONFIRM )
@@ -927,6 +938,7 @@ void ci_udp_sendmsg_send_async_q(ci_netif* ni, ci_udp_state* us)
     if( OO_PP_IS_NULL(pp) )  break;
     pkt = PKT_CHK(ni, pp);
   }
+  ci_netif_tx_push_defer_flush(ni);
 }
 
 static void ci_udp_sendmsg_async_q_enqueue(ci_netif* ni, ci_udp_state* us,
@@ -1361,6 +1373,26 @@ int ci_udp_sendmsg_fill(ci_netif* ni, ci_udp_state* us,
 }
 
 
+#ifndef __KERNEL__
+ci_inline void ci_udp_pace_refill(ci_udp_state* us, ci_uint64 now,
+                                  ci_uint64 khz, ci_int64 burst)
+{
+  ci_uint64 delta = now - us->pace_last_frc;
+  /* Any delta long enough to refill a full burst fills the bucket; it
+   * must also be saturated here, since delta * pace_rate overflows 64
+   * bits after a few seconds idle at realistic rates. */
+  ci_uint64 fill_delta = (ci_uint64) burst * khz * 1000 / us->pace_rate;
+  if( delta >= fill_delta )
+    us->pace_tokens = burst;
+  else
+    us->pace_tokens += (ci_int64) (delta * us->pace_rate / (khz * 1000));
+  us->pace_last_frc = now;
+  if( us->pace_tokens > burst )
+    us->pace_tokens = burst;
+}
+#endif
+
+
 static
 void ci_udp_sendmsg_onload(ci_netif* ni, ci_udp_state* us,
                            const ci_msghdr* msg, int flags,
@@ -1406,6 +1438,61 @@ void ci_udp_sendmsg_onload(ci_netif* ni, ci_udp_state* us,
       (bytes_to_send > (unsigned long) CI_UDP_MAX_PAYLOAD_BYTES(af)) )
     goto no_space_or_too_big;
 
+#ifndef __KERNEL__
+  /* Software token-bucket pacing (SO_MAX_PACING_RATE).  Refill from the
+   * cycle counter, then either consume tokens for this datagram, fail
+   * with EAGAIN (non-blocking), or wait for the deficit (blocking) --
+   * replacing the imprecise application-level sleeps that are otherwise
+   * needed to shape a feed.
+   */
+  if(CI_UNLIKELY( us->pace_rate != 0 )) {
+    ci_uint64 now, khz = IPTIMER_STATE(ni)->khz;
+    ci_int64 burst = CI_MAX(us->pace_rate / 100, (ci_uint64) 0x10000);
+    ci_uint64 waited_usec = 0;
+
+    ci_frc64(&now);
+    ci_udp_pace_refill(us, now, khz, burst);
+
+    while( us->pace_tokens < (ci_int64) bytes_to_send ) {
+      ci_uint64 deficit = bytes_to_send - us->pace_tokens;
+      ci_uint64 wait_usec = deficit * 1000000 / us->pace_rate;
+
+      if( (flags & MSG_DONTWAIT) ||
+          (us->s.b.sb_aflags &
+           (CI_SB_AFLAG_O_NONBLOCK | CI_SB_AFLAG_O_NDELAY)) ) {
+        ++us->stats.n_tx_eagain;
+        sinf->rc = -EAGAIN;
+        return;
+      }
+
+      /* Never wait holding the stack lock (with EF_UDP_SEND_UNLOCKED=0
+       * we can be called with it held): every other socket in the
+       * stack would stall behind this socket's shaping. */
+      if( sinf->stack_locked ) {
+        ci_netif_unlock(ni);
+        sinf->stack_locked = 0;
+      }
+
+      /* Bounded naps so the wait honours SO_SNDTIMEO and signals. */
+      if( usleep(CI_MIN(wait_usec + 1, (ci_uint64) 1000)) != 0 ) {
+        sinf->rc = -EINTR;
+        return;
+      }
+      waited_usec += CI_MIN(wait_usec + 1, (ci_uint64) 1000);
+      if( sinf->timeout != 0 &&
+          waited_usec >= (ci_uint64) sinf->timeout * 1000 ) {
+        ++us->stats.n_tx_eagain;
+        sinf->rc = -EAGAIN;
+        return;
+      }
+
+      ci_frc64(&now);
+      ci_udp_pace_refill(us, now, khz, burst);
+    }
+    us->pace_tokens -= bytes_to_send;
+  }
+#endif
+
  back_to_fast_path:
   was_locked = sinf->stack_locked;
   if( need_frag && is_sock_flag_always_df_set(&us->s, af) ) {
@@ -2641,6 +2641,32 @@ static void citp_epoll_get_ordering_limit(ci_netif* ni,
 }
 
 
+/* Compute the returnable-ordering horizon across all stacks present in
+ * the epoll set: an event may only be returned if no stack might still
+ * deliver an earlier one, so the limit is the minimum over the stacks'
+ * individual limits. */
+/* Number of distinct stacks an ordered wait tracks without heap
+ * allocation; sets spanning more stacks grow the array dynamically so
+ * the ordering guarantee is never silently narrowed. */
+#define CITP_WODA_STATIC_STACKS 8
+
+static void citp_epoll_get_ordering_limit_multi(ci_netif** nis, int n_nis,
+                                                struct timespec* limit_out)
+{
+  struct timespec stack_limit;
+  int i;
+
+  if( n_nis == 0 )
+    return;
+  citp_epoll_get_ordering_limit(nis[0], limit_out);
+  for( i = 1; i < n_nis; ++i ) {
+    citp_epoll_get_ordering_limit(nis[i], &stack_limit);
+    if( citp_timespec_compare(&stack_limit, limit_out) < 0 )
+      *limit_out = stack_limit;
+  }
+}
+
+
 static int citp_epoll_ordering_compare(const void* a, const void* b)
 {
   return citp_timespec_compare(
@@ -2737,7 +2763,10 @@ int citp_epoll_ordered_wait(citp_fdinfo* fdi,
   struct citp_epoll_fd* ep = fdi_to_epoll(fdi);
   struct citp_epoll_member* eitem;
   citp_fdinfo* sock_fdi = NULL;
-  citp_sock_fdi* sock_epi;
+  ci_netif* nis_static[CITP_WODA_STATIC_STACKS];
+  ci_netif** nis = nis_static;
+  int nis_capacity = CITP_WODA_STATIC_STACKS;
+  int n_nis = 0;
   ci_netif* ni;
   struct timespec limit_ts = {0, 0};
   struct citp_ordered_wait wait;
@@ -2752,6 +2781,7 @@ int citp_epoll_ordered_wait(citp_fdinfo* fdi,
 
  new_stack:
   ni = NULL;
+  n_nis = 0;
 
   CITP_EPOLL_EP_LOCK(ep);
 
@@ -2804,30 +2834,65 @@ int citp_epoll_ordered_wait(citp_fdinfo* fdi,
   if( ep->home_stack ) {
     ni = ep->home_stack;
     citp_netif_add_ref(ni);
+    nis[n_nis++] = ni;
   }
-  else
 #endif
   if( ci_dllist_not_empty(&ep->oo_sockets) ) {
     ci_dllink *link;
+    int i;
     ci_assert(ep->oo_sockets_n);
 
     if( citp_fdtable_not_mt_safe() )
       CITP_FDTABLE_LOCK_RD();
 
+    /* Collect the distinct stacks in the set so that ordering can be
+     * established across all of them; the first doubles as the stack to
+     * keep polled during the wait. */
     CI_DLLIST_FOR_EACH(link, &ep->oo_sockets) {
       eitem = CI_CONTAINER(struct citp_epoll_member, dllink, link);
 
       ci_assert_lt(eitem->fd, citp_fdtable.inited_count);
 
-      /* Use the first orderable socket we find to select the netif to use
-       * for ordering.
-       */
       if(CI_LIKELY( (sock_fdi = citp_ul_epoll_member_to_fdi(eitem)) != NULL )) {
         if( citp_fdinfo_is_socket(sock_fdi) ) {
-          sock_epi = fdi_to_sock_fdi(sock_fdi);
-          ni = sock_epi->sock.netif;
-          citp_netif_add_ref(ni);
-          break;
+          ci_netif* sock_ni = fdi_to_sock_fdi(sock_fdi)->sock.netif;
+          for( i = 0; i < n_nis; ++i )
+            if( nis[i] == sock_ni )
+              break;
+          if( i == n_nis ) {
+            if( n_nis == nis_capacity ) {
+              /* More distinct stacks than we have room for: grow, so
+               * that every stack participates in the ordering limit. */
+              ci_netif** new_nis = ci_alloc(sizeof(nis[0]) *
+                                            nis_capacity * 2);
+              if( new_nis == NULL ) {
+                /* Cannot honour the cross-stack ordering guarantee for
+                 * a stack we cannot track: give up loudly rather than
+                 * return misordered events. */
+                ci_log("%s: ERROR: out of memory tracking %d stacks for "
+                       "ordered wait", __FUNCTION__, n_nis + 1);
+                if( citp_fdtable_not_mt_safe() )
+                  CITP_FDTABLE_UNLOCK_RD();
+                CITP_EPOLL_EP_UNLOCK(ep, 0);
+                citp_exit_lib(lib_context, FALSE);
+                while( n_nis > 0 )
+                  citp_netif_release_ref(nis[--n_nis], 0);
+                if( nis != nis_static )
+                  ci_free(nis);
+                errno = ENOMEM;
+                return -1;
+              }
+              memcpy(new_nis, nis, sizeof(nis[0]) * n_nis);
+              if( nis != nis_static )
+                ci_free(nis);
+              nis = new_nis;
+              nis_capacity *= 2;
+            }
+            citp_netif_add_ref(sock_ni);
+            nis[n_nis++] = sock_ni;
+            if( ni == NULL )
+              ni = sock_ni;
+          }
         }
       }
     }
@@ -2840,7 +2905,7 @@ int citp_epoll_ordered_wait(citp_fdinfo* fdi,
   CITP_EPOLL_EP_UNLOCK(ep, 0);
 
  again:
-  citp_epoll_get_ordering_limit(ni, &limit_ts);
+  citp_epoll_get_ordering_limit_multi(nis, n_nis, &limit_ts);
 
   wait.ordering_info = ep->ordering_info;
   wait.poll_again = 0;
@@ -2861,7 +2926,7 @@ int citp_epoll_ordered_wait(citp_fdinfo* fdi,
     citp_reenter_lib(lib_context);
     if( ni == NULL )
       goto new_stack;
-    citp_epoll_get_ordering_limit(ni, &limit_ts);
+    citp_epoll_get_ordering_limit_multi(nis, n_nis, &limit_ts);
 
     rc = citp_epoll_wait(fdi, ep->wait_events, &wait, n_socks,
                          0, sigmask, lib_context);
@@ -2886,15 +2951,22 @@ int citp_epoll_ordered_wait(citp_fdinfo* fdi,
       citp_reenter_lib(lib_context);
       timeout_hr = wait.next_timeout_hr;
       Log_POLL(ci_log("%s: all events vanished.  Stack change?", __FUNCTION__));
-      if( ni )
-        citp_netif_release_ref(ni, 0);
+      while( n_nis > 0 )
+        citp_netif_release_ref(nis[--n_nis], 0);
+      if( nis != nis_static ) {
+        ci_free(nis);
+        nis = nis_static;
+        nis_capacity = CITP_WODA_STATIC_STACKS;
+      }
       goto new_stack;
     }
   }
 
 out:
-  if( ni )
-    citp_netif_release_ref(ni, 0);
+  while( n_nis > 0 )
+    citp_netif_release_ref(nis[--n_nis], 0);
+  if( nis != nis_static )
+    ci_free(nis);
   return rc;
 }
 #endif /* CI_CFG_TIMESTAMPING */
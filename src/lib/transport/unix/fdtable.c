@@ -738,6 +738,9 @@ citp_fdtable_lookup(unsigned fd)
           }
 	  return fdi;
 	}
+	/* Lost a race to another thread looking up or closing this fd;
+	 * back off briefly so we aren't hammering the contended line. */
+	ci_spinloop_pause();
 	goto again;
       }
       else {
@@ -844,6 +847,8 @@ citp_fdtable_lookup_fast(citp_lib_context_t* ctx, unsigned fd)
           }
 	  return fdi;
 	}
+	/* As in citp_fdtable_lookup(): back off briefly on a lost race. */
+	ci_spinloop_pause();
 	goto again;
       }
     }
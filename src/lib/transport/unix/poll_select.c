@@ -567,19 +567,21 @@ static int citp_ul_poll(int nfds, struct oo_ul_poll_state*__restrict__ ps)
     if( fd < citp_fdtable.inited_count ) {
       citp_fdinfo_p fdip = citp_fdtable.table[fd].fdip;
       if( fdip_is_normal(fdip) ) {
+        citp_fdinfo* fdi = fdip_to_fdi(fdip);
+        citp_fdops* ops = citp_fdinfo_get_ops(fdi);
         ++ps->n_ul_fds;
 
         /* If SO_BUSY_POLL behaviour requested need to check if there is
          * a spinning socket in the set, and remove flag to enable spinning
-         * if it is found */
+         * if it is found.  Note this resolves on the first scan: either a
+         * spinning socket clears the flag here, or the absence of one
+         * zeroes ul_poll_spin below, so spin iterations skip it. */
         if( ( ps->ul_poll_spin & (1 << ONLOAD_SPIN_SO_BUSY_POLL) ) &&
-            citp_fdinfo_get_ops(fdip_to_fdi(fdip))->
-                                        is_spinning(fdip_to_fdi(fdip)) ) {
+            ops->is_spinning(fdi) ) {
           ps->ul_poll_spin &= ~(1 << ONLOAD_SPIN_SO_BUSY_POLL);
         }
 
-        if( citp_fdinfo_get_ops(fdip_to_fdi(fdip))->poll(fdip_to_fdi(fdip),
-                                                         &ps->pfds[i], ps) ) {
+        if( ops->poll(fdi, &ps->pfds[i], ps) ) {
           if( ps->pfds[i].revents != 0 )
             ++ps->n_ul_ready;
           continue;
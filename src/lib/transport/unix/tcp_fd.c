@@ -1703,8 +1703,8 @@ static int citp_tcp_recv(citp_fdinfo* fdinfo, struct msghdr* msg, int flags)
   if (epi->sock.s->b.sb_aflags & (CI_SB_AFLAG_O_NONBLOCK|CI_SB_AFLAG_O_NDELAY))
     flags |= MSG_DONTWAIT;
 
-  if( (flags & (MSG_WAITALL | ONLOAD_MSG_ONEPKT)) ==
-      (MSG_WAITALL | ONLOAD_MSG_ONEPKT) ) {
+  if(CI_UNLIKELY( flags & ONLOAD_MSG_ONEPKT ) &&
+     (flags & MSG_WAITALL) ) {
     Log_E(ci_log("WAITALL and ONEPKT is not a valid flag combination"));
     errno = EINVAL;
     return -1;
@@ -196,6 +196,77 @@ int onload_zc_hlrx_buffer_release(int fd, onload_zc_handle buf)
 }
 
 
+int onload_zc_hlrx_buffer_release_n(int fd, onload_zc_handle* bufs, int n)
+{
+  /* Entries are processed in windows.  Nothing in a window is committed
+   * irrevocably until the window flushes: local buffers whose user
+   * reference drops to zero are queued (not yet freed), surviving
+   * decrefs are recorded so they can be undone, and remote buffers are
+   * only marked done at flush time after the local frees succeeded.  On
+   * a flush failure the current window is rolled back exactly, so the
+   * return value is always the number of leading entries fully
+   * released, and the caller may re-present the remainder unchanged.
+   */
+  enum { W_REMOTE, W_LOCAL_FREE, W_LOCAL_HELD };
+#define HLRX_RELEASE_WINDOW 64
+  onload_zc_handle to_free[HLRX_RELEASE_WINDOW];
+  uint8_t wclass[HLRX_RELEASE_WINDOW];
+  int i, w = 0, n_free = 0, rc = 0;
+  int done_upto = 0;
+
+  for( i = 0; i < n; ++i ) {
+    if(CI_UNLIKELY( zc_is_remote(bufs[i]) )) {
+      wclass[w++] = W_REMOTE;
+    }
+    else {
+      ci_ip_pkt_fmt* pkt = zc_handle_to_pktbuf(bufs[i]);
+      /* See onload_zc_buffer_decref() for why the non-atomic test for
+       * the last reference is sound. */
+      if( pkt->user_refcount == CI_ZC_USER_REFCOUNT_ONE ||
+          __sync_sub_and_fetch(&pkt->user_refcount, 1) <
+              CI_ZC_USER_REFCOUNT_ONE ) {
+        to_free[n_free++] = bufs[i];
+        wclass[w++] = W_LOCAL_FREE;
+      }
+      else {
+        wclass[w++] = W_LOCAL_HELD;
+      }
+    }
+
+    if( w == HLRX_RELEASE_WINDOW || i == n - 1 ) {
+      if( n_free > 0 )
+        rc = onload_zc_release_buffers(fd, to_free, n_free);
+      if( rc < 0 ) {
+        /* Roll the window back precisely: queued buffers get their
+         * final reference back, surviving decrefs are re-granted, and
+         * remotes were never marked. */
+        int j;
+        for( j = 0; j < w; ++j ) {
+          if( wclass[j] == W_LOCAL_FREE )
+            zc_handle_to_pktbuf(bufs[done_upto + j])->user_refcount =
+              CI_ZC_USER_REFCOUNT_ONE;
+          else if( wclass[j] == W_LOCAL_HELD )
+            __sync_fetch_and_add(
+              &zc_handle_to_pktbuf(bufs[done_upto + j])->user_refcount, 1);
+        }
+        return done_upto > 0 ? done_upto : rc;
+      }
+      for( rc = 0; rc < w; ++rc )
+        if( wclass[rc] == W_REMOTE ) {
+          uint64_t* rd = zc_handle_to_remote(bufs[done_upto + rc]);
+          OO_ACCESS_ONCE(*rd) |= HLRX_REMOTE_PTR_DONE_FLAG;
+        }
+      rc = 0;
+      done_upto = i + 1;
+      w = 0;
+      n_free = 0;
+    }
+  }
+  return done_upto;
+#undef HLRX_RELEASE_WINDOW
+}
+
+
 /* *********************************************************************** */
 
 /* Temporary structure we need to pass as the cookie to the callback of
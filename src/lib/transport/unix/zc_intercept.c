@@ -388,6 +388,56 @@ int onload_zc_send(struct onload_zc_mmsg* msgs, int mlen, int flags)
 }
 
 
+int onload_zc_send_completions(int fd, void** app_cookies, int n)
+{
+  int rc, total = 0;
+  citp_lib_context_t lib_context;
+  citp_fdinfo* fdi;
+
+  Log_CALL(ci_log("%s(%d, %p, %d)", __FUNCTION__, fd, app_cookies, n));
+
+  /* A single drain can surface up to ONLOAD_ZC_COMPLETIONS_MIN cookies,
+   * which cannot be put back, so insist the caller has room for them. */
+  if( n < ONLOAD_ZC_COMPLETIONS_MIN )
+    return -EINVAL;
+
+  if( (fdi = citp_fdtable_lookup_fast(&lib_context, fd)) ) {
+    while( n - total >= ONLOAD_ZC_COMPLETIONS_MIN ) {
+      /* Room for a batch of cookie cmsgs plus interleaved timestamping
+       * cmsgs, which we skip over. */
+      char control[CMSG_SPACE(sizeof(void*)) * ONLOAD_ZC_COMPLETIONS_MIN
+                   + 256];
+      struct msghdr msg;
+      struct cmsghdr* cm;
+
+      memset(&msg, 0, sizeof(msg));
+      msg.msg_control = control;
+      msg.msg_controllen = sizeof(control);
+
+      rc = citp_fdinfo_get_ops(fdi)->recv(fdi, &msg,
+                                          MSG_ERRQUEUE | MSG_DONTWAIT);
+      if( rc < 0 )
+        break;
+
+      for( cm = CMSG_FIRSTHDR(&msg); cm != NULL;
+           cm = CMSG_NXTHDR(&msg, cm) )
+        if( cm->cmsg_level == SOL_IP &&
+            cm->cmsg_type == ONLOAD_SO_ONLOADZC_COMPLETE )
+          memcpy(&app_cookies[total++], CMSG_DATA(cm), sizeof(void*));
+    }
+    citp_fdinfo_release_ref_fast(fdi);
+    citp_exit_lib(&lib_context, TRUE);
+  }
+  else {
+    citp_exit_lib_if(&lib_context, TRUE);
+    return -ESOCKTNOSUPPORT;
+  }
+
+  Log_CALL_RESULT(total);
+  return total;
+}
+
+
 int onload_set_recv_filter(int fd, onload_zc_recv_filter_callback filter,
                            void* cb_arg, int flags)
 {
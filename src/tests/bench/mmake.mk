@@ -0,0 +1,20 @@
+# SPDX-License-Identifier: BSD-2-Clause
+# X-SPDX-Copyright-Text: (c) Copyright 2026 Advanced Micro Devices, Inc.
+
+TEST_APPS	:= oo_bench
+TARGETS		:= $(TEST_APPS:%=$(AppPattern))
+
+
+all: $(TARGETS)
+
+clean:
+	@$(MakeClean)
+
+
+MMAKE_INCLUDE	+= -I$(TOPPATH)/src/lib/ciul
+
+MMAKE_LIBS	:= $(LINK_CIUL_LIB)
+MMAKE_LIB_DEPS	:= $(CIUL_LIB_DEPEND)
+
+
+oo_bench: oo_bench.o
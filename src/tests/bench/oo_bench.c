@@ -0,0 +1,247 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+/* X-SPDX-Copyright-Text: (c) Copyright 2026 Advanced Micro Devices, Inc. */
+
+/* Microbenchmarks for internal primitives.
+ *
+ * These drive a small set of hot library routines in isolation so that
+ * optimisation work has numbers to stand on.  They deliberately avoid
+ * needing hardware or a live stack: everything here runs against plain
+ * memory.  Current benchmarks:
+ *
+ *   csum       -- ef_udp_checksum() over a range of payload sizes,
+ *                 exercising the vectorised block kernels.
+ *   csum_check -- correctness: checksum entry points compared against
+ *                 an independent scalar reference across payload sizes
+ *                 0..9000, all source alignments mod 16, odd tails and
+ *                 split iovecs.  Exercises whichever block kernel the
+ *                 runtime CPU dispatch selects on this machine.
+ *   piocopy    -- memcpy_to_pio()/memcpy_to_pio_nt() fixed-size
+ *                 variants.
+ *
+ * Usage: oo_bench [name ...]   (default: run everything)
+ * Output: one line per case, ns per operation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <netinet/ip.h>
+#include <netinet/udp.h>
+#include <sys/uio.h>
+#include <etherfabric/checksum.h>
+
+#include "ef_vi_internal.h"
+#include "memcpy_to_io.h"
+
+
+static ci_uint64 now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (ci_uint64) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+static volatile ci_uint64 sink;
+
+/* Independent reference: RFC1071 summation, byte at a time. */
+static uint32_t ref_fold(uint64_t sum)
+{
+  while( sum >> 16 )
+    sum = (sum & 0xffff) + (sum >> 16);
+  return (uint32_t) sum;
+}
+
+static uint64_t ref_sum(uint64_t sum, const void* buf, size_t len)
+{
+  const uint8_t* p = buf;
+  size_t i;
+  for( i = 0; i + 1 < len; i += 2 )
+    sum += (uint16_t) (p[i] | (p[i + 1] << 8));
+  if( len & 1 )
+    sum += p[len - 1];
+  return sum;
+}
+
+static int check_one_udp(const unsigned char* payload, int len, int split)
+{
+  struct iphdr ip;
+  struct udphdr udp;
+  struct iovec iov[2];
+  int iovlen;
+  uint64_t sum;
+  uint32_t got, want;
+
+  memset(&ip, 0, sizeof(ip));
+  ip.saddr = 0xc0a80101;
+  ip.daddr = 0xc0a80202;
+  udp.source = 0xaa55;
+  udp.dest = 0x55aa;
+  udp.len = htons(8 + len);
+  udp.check = 0;
+
+  if( split > 0 && split < len ) {
+    iov[0].iov_base = (void*) payload;
+    iov[0].iov_len = split;
+    iov[1].iov_base = (void*) (payload + split);
+    iov[1].iov_len = len - split;
+    iovlen = 2;
+  }
+  else {
+    iov[0].iov_base = (void*) payload;
+    iov[0].iov_len = len;
+    iovlen = 1;
+  }
+
+  got = ef_udp_checksum(&ip, &udp, iov, iovlen);
+
+  sum = ref_sum(0, &ip.saddr, 4);
+  sum = ref_sum(sum, &ip.daddr, 4);
+  sum += htons(IPPROTO_UDP);
+  sum = ref_sum(sum, &udp.len, 2);
+  sum = ref_sum(sum, &udp, 6);
+  sum = ref_sum(sum, payload, len);
+  want = ~ref_fold(sum) & 0xffff;
+  if( want == 0 )
+    want = 0xffff;
+
+  if( got != want ) {
+    fprintf(stderr, "csum_check: MISMATCH len=%d split=%d align=%ld "
+            "got=%04x want=%04x\n", len, split,
+            (long) ((uintptr_t) payload & 15), got, want);
+    return 1;
+  }
+  return 0;
+}
+
+static void bench_csum_check(void)
+{
+  static unsigned char buf[9000 + 64];
+  int len, align, fails = 0;
+  unsigned i;
+
+  for( i = 0; i < sizeof(buf); ++i )
+    buf[i] = i * 131 + 7;
+
+  /* Every length up to 512 at every alignment mod 16, then sparser
+   * lengths (crossing the vector threshold and up to jumbo sizes) with
+   * a rotating alignment and a mid-buffer iovec split. */
+  for( len = 0; len <= 512; ++len )
+    for( align = 0; align < 16; ++align )
+      fails += check_one_udp(buf + align, len, 0);
+  for( len = 513; len <= 9000; len += 7 ) {
+    align = len & 15;
+    fails += check_one_udp(buf + align, len, 0);
+    fails += check_one_udp(buf + align, len, (len / 2) | 1);
+  }
+
+  if( fails ) {
+    fprintf(stderr, "csum_check: FAILED (%d mismatches)\n", fails);
+    exit(1);
+  }
+  printf("csum_check        PASS\n");
+}
+
+static void bench_csum(void)
+{
+  static const int sizes[] = { 32, 128, 512, 1472, 8192 };
+  unsigned char payload[8192];
+  struct iphdr ip;
+  struct udphdr udp;
+  unsigned i, s;
+
+  memset(&ip, 0, sizeof(ip));
+  ip.saddr = 0x0a000001;
+  ip.daddr = 0x0a000002;
+  for( i = 0; i < sizeof(payload); ++i )
+    payload[i] = i;
+
+  for( s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s ) {
+    struct iovec iov = { payload, sizes[s] };
+    int iters = 2000000;
+    ci_uint64 t0, t1;
+    udp.source = 0x1234;
+    udp.dest = 0x4321;
+    udp.len = htons(8 + sizes[s]);
+    udp.check = 0;
+    t0 = now_ns();
+    for( i = 0; i < (unsigned) iters; ++i )
+      sink += ef_udp_checksum(&ip, &udp, &iov, 1);
+    t1 = now_ns();
+    printf("csum/%-5d        %7.1f ns/op\n", sizes[s],
+           (double) (t1 - t0) / iters);
+  }
+}
+
+
+static void bench_piocopy(void)
+{
+  static char aperture[512] __attribute__((aligned(64)));
+  static char src[256] __attribute__((aligned(64)));
+  int iters = 5000000;
+  ci_uint64 t0, t1;
+  int i;
+
+  for( i = 0; i < (int) sizeof(src); ++i )
+    src[i] = i;
+
+  t0 = now_ns();
+  for( i = 0; i < iters; ++i )
+    memcpy_to_pio_aligned(aperture, src, 64);
+  t1 = now_ns();
+  printf("piocopy/64        %7.1f ns/op\n", (double) (t1 - t0) / iters);
+
+  t0 = now_ns();
+  for( i = 0; i < iters; ++i )
+    memcpy_to_pio_aligned(aperture, src, 256);
+  t1 = now_ns();
+  printf("piocopy/256       %7.1f ns/op\n", (double) (t1 - t0) / iters);
+
+#if !defined(__KERNEL__) && defined(__x86_64__)
+  t0 = now_ns();
+  for( i = 0; i < iters; ++i )
+    memcpy_to_pio_nt(aperture, src, 256);
+  t1 = now_ns();
+  printf("piocopy-nt/256    %7.1f ns/op\n", (double) (t1 - t0) / iters);
+#endif
+}
+
+
+struct bench {
+  const char* name;
+  void (*fn)(void);
+};
+
+static const struct bench benches[] = {
+  { "csum", bench_csum },
+  { "csum_check", bench_csum_check },
+  { "piocopy", bench_piocopy },
+};
+
+
+int main(int argc, char** argv)
+{
+  unsigned i;
+  int ran = 0;
+
+  for( i = 0; i < sizeof(benches) / sizeof(benches[0]); ++i ) {
+    int want = argc < 2;
+    int a;
+    for( a = 1; a < argc; ++a )
+      if( strcmp(argv[a], benches[i].name) == 0 )
+        want = 1;
+    if( want ) {
+      benches[i].fn();
+      ran = 1;
+    }
+  }
+  if( ! ran ) {
+    fprintf(stderr, "usage: %s [", argv[0]);
+    for( i = 0; i < sizeof(benches) / sizeof(benches[0]); ++i )
+      fprintf(stderr, "%s%s", i ? "|" : "", benches[i].name);
+    fprintf(stderr, "] ...\n");
+    return 1;
+  }
+  return 0;
+}
@@ -28,12 +28,14 @@
 /* Forward declarations. */
 static inline void rx_wait_no_ts(ef_vi*);
 static inline void rx_wait_with_ts(ef_vi*);
+static void report_percentiles(void);
 
 
 #define DEFAULT_PAYLOAD_SIZE  0
 
 
 static int              cfg_iter = 100000;
+static uint64_t*        rtt_ns;
 static int              cfg_warmups = 10000;
 static unsigned		cfg_payload_len = DEFAULT_PAYLOAD_SIZE;
 static int              cfg_ctpio_no_poison;
@@ -46,6 +48,8 @@ enum mode {
   MODE_DEFAULT = MODE_CTPIO | MODE_ALT | MODE_PIO | MODE_DMA
 };
 static unsigned         cfg_mode = MODE_DEFAULT;
+static const char*      cfg_raw_file;
+static int              cfg_percentiles;
 
 
 #define N_RX_BUFS	256u
@@ -149,10 +153,28 @@ generic_ping(ef_vi* vi, void (*rx_wait)(ef_vi*), void (*tx_send)(ef_vi*))
 
   gettimeofday(&start, NULL);
 
-  for( i = 0; i < cfg_iter; ++i ) {
-    tx_send(vi);
-    rx_post(vi);
-    rx_wait(vi);
+  if( rtt_ns != NULL ) {
+    /* Per-iteration sampling is opt-in (-P / -o): the clock reads add a
+     * small per-iteration overhead to the loop, so the default timed
+     * loop below stays identical to previous releases and its mean
+     * remains comparable. */
+    for( i = 0; i < cfg_iter; ++i ) {
+      struct timespec t0, t1;
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      tx_send(vi);
+      rx_post(vi);
+      rx_wait(vi);
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      rtt_ns[i] = (t1.tv_sec - t0.tv_sec) * 1000000000ull +
+                  (t1.tv_nsec - t0.tv_nsec);
+    }
+  }
+  else {
+    for( i = 0; i < cfg_iter; ++i ) {
+      tx_send(vi);
+      rx_post(vi);
+      rx_wait(vi);
+    }
   }
 
   gettimeofday(&end, NULL);
@@ -160,6 +182,21 @@ generic_ping(ef_vi* vi, void (*rx_wait)(ef_vi*), void (*tx_send)(ef_vi*))
   usec = (end.tv_sec - start.tv_sec) * 1000000;
   usec += end.tv_usec - start.tv_usec;
   printf("mean round-trip time: %0.3f usec\n", (double) usec / cfg_iter);
+  if( rtt_ns != NULL ) {
+    /* Report the sampling overhead so the mean above can be compared
+     * with unsampled runs. */
+    struct timespec t0, t1;
+    ci_uint64 oh = 0;
+    for( i = 0; i < 1000; ++i ) {
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      oh += (t1.tv_sec - t0.tv_sec) * 1000000000ull +
+            (t1.tv_nsec - t0.tv_nsec);
+    }
+    printf("# per-iteration clock overhead: ~%0.1f ns (included in mean)\n",
+           (double) oh / 1000);
+    report_percentiles();
+  }
 }
 
 static void
@@ -506,6 +543,45 @@ static const test_t* do_init(int ifindex)
 }
 
 
+static int cmp_u64(const void* a, const void* b)
+{
+  uint64_t va = *(const uint64_t*) a, vb = *(const uint64_t*) b;
+  return va < vb ? -1 : va > vb;
+}
+
+
+static void report_percentiles(void)
+{
+  static const double centiles[] = { 50, 90, 99, 99.9 };
+  unsigned i;
+
+  if( cfg_raw_file != NULL ) {
+    FILE* f = fopen(cfg_raw_file, "w");
+    if( f == NULL ) {
+      fprintf(stderr, "ERROR: cannot write %s\n", cfg_raw_file);
+    }
+    else {
+      fprintf(f, "iteration,rtt_ns\n");
+      for( i = 0; i < (unsigned) cfg_iter; ++i )
+        fprintf(f, "%u,%" PRIu64 "\n", i, rtt_ns[i]);
+      fclose(f);
+    }
+  }
+
+  qsort(rtt_ns, cfg_iter, sizeof(rtt_ns[0]), cmp_u64);
+  printf("round-trip time: min %0.3f usec\n", rtt_ns[0] / 1000.0);
+  for( i = 0; i < sizeof(centiles) / sizeof(centiles[0]); ++i ) {
+    unsigned idx = (unsigned) (centiles[i] / 100.0 * cfg_iter);
+    if( idx >= (unsigned) cfg_iter )
+      idx = cfg_iter - 1;
+    printf("round-trip time: %%ile %-5g %0.3f usec\n", centiles[i],
+           rtt_ns[idx] / 1000.0);
+  }
+  printf("round-trip time: max %0.3f usec\n",
+         rtt_ns[cfg_iter - 1] / 1000.0);
+}
+
+
 static CI_NORETURN usage(void)
 {
   fprintf(stderr, "\nusage:\n");
@@ -518,6 +594,10 @@ static CI_NORETURN usage(void)
   fprintf(stderr, "  -p                  - CTPIO no-poison mode\n");
   fprintf(stderr, "  -m <modes>          - allow mode of the set: [c]tpio, \n");
   fprintf(stderr, "                      [pio], [a]lternatives, [d]ma, [x]dp\n");
+  fprintf(stderr, "  -P                  - sample per-iteration RTTs and\n");
+  fprintf(stderr, "                        report percentiles\n");
+  fprintf(stderr, "  -o <file>           - write per-iteration RTTs as CSV\n");
+  fprintf(stderr, "                        (implies -P)\n");
   fprintf(stderr, "\n");
   exit(1);
 }
@@ -532,7 +612,7 @@ int main(int argc, char* argv[])
 
   printf("# ef_vi_version_str: %s\n", ef_vi_version_str());
 
-  while( (c = getopt (argc, argv, "n:s:w:c:pm:")) != -1 )
+  while( (c = getopt (argc, argv, "n:s:w:c:pm:o:P")) != -1 )
     switch( c ) {
     case 'n':
       cfg_iter = atoi(optarg);
@@ -549,6 +629,13 @@ int main(int argc, char* argv[])
     case 'p':
       cfg_ctpio_no_poison = 1;
       break;
+    case 'o':
+      cfg_raw_file = optarg;
+      cfg_percentiles = 1;
+      break;
+    case 'P':
+      cfg_percentiles = 1;
+      break;
     case 'm':
       #define OPT_C(ch) (strchr(optarg, ch) != NULL)
       cfg_mode =
@@ -567,6 +654,14 @@ int main(int argc, char* argv[])
   argc -= optind;
   argv += optind;
 
+  if( cfg_percentiles ) {
+    rtt_ns = calloc(cfg_iter, sizeof(rtt_ns[0]));
+    if( rtt_ns == NULL ) {
+      fprintf(stderr, "ERROR: cannot allocate RTT sample buffer\n");
+      exit(1);
+    }
+  }
+
   if( argc != 2 )
     usage();
   if( ! parse_interface(argv[1], &ifindex) )
@@ -2,6 +2,7 @@
 # X-SPDX-Copyright-Text: (c) Copyright 2002-2020 Xilinx, Inc.
 ifeq ($(GNU),1)
 SUBDIRS		:=     driver \
+                   bench \
                    ef_vi \
                    onload \
                    orm_test_client \